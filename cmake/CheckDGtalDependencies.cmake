@@ -31,6 +31,12 @@ if ( ZLIB_FOUND )
   SET(DGtalLibDependencies ${DGtalLibDependencies} ${ZLIB_LIBRARIES})
 endif( ZLIB_FOUND )
 
+# -----------------------------------------------------------------------------
+# Looking for threads (std::thread, e.g. in ImageFactoryAsync)
+# -----------------------------------------------------------------------------
+FIND_PACKAGE(Threads REQUIRED)
+SET(DGtalLibDependencies ${DGtalLibDependencies} ${CMAKE_THREAD_LIBS_INIT})
+
 # -----------------------------------------------------------------------------
 # Setting librt dependency on Linux
 # -----------------------------------------------------------------------------
@@ -0,0 +1,576 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FlatHashContainers.h
+ *
+ * @date 2026/10/16
+ *
+ * @brief Open addressing hash set and hash map (FlatHashSet, FlatHashMap).
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testFlatHashContainers.cpp
+ */
+
+#if defined(FlatHashContainers_RECURSES)
+#error Recursive header files inclusion detected in FlatHashContainers.h
+#else // defined(FlatHashContainers_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatHashContainers_RECURSES
+
+#if !defined FlatHashContainers_h
+/** Prevents repeated inclusion of headers. */
+#define FlatHashContainers_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <tuple>
+#include <iterator>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /// Key extractor of FlatHashSet: the value is the key.
+    template <typename TKey>
+    struct FlatHashSetKeyOfValue
+    {
+      typedef TKey Key;
+      static const bool isSet = true;
+      const Key& operator()( const TKey & aValue ) const
+      { return aValue; }
+    };
+
+    /// Key extractor of FlatHashMap: the key is the first member of the pair.
+    template <typename TKey, typename TValue>
+    struct FlatHashMapKeyOfValue
+    {
+      typedef TKey Key;
+      static const bool isSet = false;
+      const Key& operator()( const TValue & aValue ) const
+      { return aValue.first; }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class FlatHashTable
+    /**
+       Description of template class 'FlatHashTable' <p> \brief Aim:
+       Hash table with open addressing and linear probing, which is the
+       common implementation of FlatHashSet and FlatHashMap.
+
+       Values are stored in one array of slots, whose state (empty,
+       full, erased) is stored in a parallel array of bytes. The
+       number of slots is a power of two and the hash values are mixed
+       before being masked, so that poor hash functions (e.g. the
+       identity on integers) still spread well. Erased slots are
+       marked as such (tombstones), so that erasing does not move any
+       value: iterators to the other values stay valid. Inserting may
+       rehash the table and invalidates all the iterators, references
+       and pointers to values (contrary to std::unordered_map).
+
+       @tparam TValue the type of stored values.
+       @tparam TKeyOfValue the functor extracting the key from a value.
+       @tparam THash the hash functor on keys.
+       @tparam TKeyEqual the equality predicate on keys.
+    */
+    template <typename TValue, typename TKeyOfValue,
+              typename THash, typename TKeyEqual>
+    class FlatHashTable
+    {
+    public:
+      typedef FlatHashTable<TValue, TKeyOfValue, THash, TKeyEqual> Self;
+      typedef typename TKeyOfValue::Key key_type;
+      typedef TValue value_type;
+      typedef THash hasher;
+      typedef TKeyEqual key_equal;
+      typedef std::size_t size_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef value_type & reference;
+      typedef const value_type & const_reference;
+      typedef value_type * pointer;
+      typedef const value_type * const_pointer;
+
+      /// Forward iterator on the full slots (constant for sets).
+      template <bool IsConst>
+      class Iterator
+      {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef TValue value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional< IsConst || TKeyOfValue::isSet,
+                                           const TValue &, TValue & >::type reference;
+        typedef typename std::conditional< IsConst || TKeyOfValue::isSet,
+                                           const TValue *, TValue * >::type pointer;
+
+        Iterator() : myState( 0 ), mySlot( 0 ) {}
+        Iterator( const unsigned char* aState, TValue* aSlot )
+          : myState( aState ), mySlot( aSlot ) {}
+        /// Conversion from a mutable iterator.
+        template <bool OtherIsConst,
+                  typename = typename std::enable_if< IsConst || ! OtherIsConst >::type>
+        Iterator( const Iterator<OtherIsConst> & other )
+          : myState( other.myState ), mySlot( other.mySlot ) {}
+
+        reference operator*() const  { return *mySlot; }
+        pointer   operator->() const { return mySlot; }
+        Iterator & operator++()
+        { //the sentinel state after the last slot is full
+          do { ++myState; ++mySlot; } while ( *myState != FULL );
+          return *this;
+        }
+        Iterator operator++( int )
+        { Iterator tmp( *this ); ++( *this ); return tmp; }
+        template <bool OtherIsConst>
+        bool operator==( const Iterator<OtherIsConst> & other ) const
+        { return myState == other.myState; }
+        template <bool OtherIsConst>
+        bool operator!=( const Iterator<OtherIsConst> & other ) const
+        { return myState != other.myState; }
+
+      private:
+        friend class FlatHashTable;
+        template <bool> friend class Iterator;
+        /// Pointer to the state of the slot.
+        const unsigned char* myState;
+        /// Pointer to the slot.
+        TValue* mySlot;
+      };
+
+      typedef Iterator<TKeyOfValue::isSet> iterator;
+      typedef Iterator<true> const_iterator;
+
+      // ----------------------- Standard services ------------------------------
+    public:
+
+      /**
+       * Constructor.
+       * @param aBucketCount minimal number of slots (0 for lazy allocation).
+       * @param aHash hash functor.
+       * @param aKeyEqual equality predicate.
+       */
+      explicit FlatHashTable( size_type aBucketCount = 0,
+                              const hasher & aHash = hasher(),
+                              const key_equal & aKeyEqual = key_equal() );
+
+      /**
+       * Constructor from a range of values.
+       * @param first begin of the range.
+       * @param last end of the range.
+       * @param aBucketCount minimal number of slots.
+       * @param aHash hash functor.
+       * @param aKeyEqual equality predicate.
+       */
+      template <typename InputIterator>
+      FlatHashTable( InputIterator first, InputIterator last,
+                     size_type aBucketCount = 0,
+                     const hasher & aHash = hasher(),
+                     const key_equal & aKeyEqual = key_equal() );
+
+      /**
+       * Constructor from an initializer list.
+       * @param aList the list of values.
+       */
+      FlatHashTable( std::initializer_list<value_type> aList );
+
+      /**
+       * Copy constructor. The copy has the same slots, hence the same
+       * order of iteration.
+       * @param other the object to clone.
+       */
+      FlatHashTable( const FlatHashTable & other );
+
+      /**
+       * Move constructor.
+       * @param other the object to move (left empty).
+       */
+      FlatHashTable( FlatHashTable && other ) noexcept;
+
+      /**
+       * Destructor.
+       */
+      ~FlatHashTable();
+
+      /**
+       * Assignment.
+       * @param other the object to copy or move.
+       * @return a reference on 'this'.
+       */
+      FlatHashTable & operator=( FlatHashTable other );
+
+      /**
+       * Swaps the content of 'this' and of @a other.
+       * @param other any other table.
+       */
+      void swap( FlatHashTable & other ) noexcept;
+
+      // ----------------------- Container services -----------------------------
+    public:
+
+      iterator begin();
+      iterator end();
+      const_iterator begin() const;
+      const_iterator end() const;
+      const_iterator cbegin() const;
+      const_iterator cend() const;
+
+      /// @return 'true' iff the container is empty.
+      bool empty() const;
+      /// @return the number of values.
+      size_type size() const;
+      /// @return the maximal number of values.
+      size_type max_size() const;
+      /// @return the number of slots.
+      size_type bucket_count() const;
+      /// @return the ratio between the number of values and of slots.
+      double load_factor() const;
+      /// @return the maximal ratio between the number of values (and
+      /// erased slots) and of slots before growing.
+      double max_load_factor() const;
+      /// @return the number of bytes used by the slots and their states.
+      size_type memoryUsage() const;
+      /// @return the hash functor.
+      hasher hash_function() const;
+      /// @return the equality predicate.
+      key_equal key_eq() const;
+
+      /**
+       * Removes all the values (keeps the slots).
+       */
+      void clear();
+
+      /**
+       * Makes room for @a n values without rehashing.
+       * @param n any number of values.
+       */
+      void reserve( size_type n );
+
+      /**
+       * Rehashes the table so that it has at least @a n slots (and
+       * enough slots for the current values). Erased slots are
+       * reclaimed.
+       * @param n any number of slots.
+       */
+      void rehash( size_type n );
+
+      /**
+       * Inserts a value if its key is not already in the table.
+       * @param aValue any value.
+       * @return an iterator on the value with this key, and 'true' iff
+       * the value was inserted.
+       */
+      std::pair<iterator, bool> insert( const value_type & aValue );
+
+      /// Inserts a value (moved) if its key is not already in the table.
+      /// @param aValue any value.
+      /// @return an iterator on the value with this key, and 'true' iff inserted.
+      std::pair<iterator, bool> insert( value_type && aValue );
+
+      /// Inserts a value (the hint is ignored).
+      /// @param hint ignored.
+      /// @param aValue any value.
+      /// @return an iterator on the value with this key.
+      iterator insert( const_iterator hint, const value_type & aValue );
+
+      /// Inserts a range of values.
+      /// @param first begin of the range.
+      /// @param last end of the range.
+      template <typename InputIterator>
+      void insert( InputIterator first, InputIterator last );
+
+      /// Inserts a list of values.
+      /// @param aList the list of values.
+      void insert( std::initializer_list<value_type> aList );
+
+      /// Constructs a value from @a args and inserts it if its key is
+      /// not already in the table.
+      /// @param args the arguments of the value constructor.
+      /// @return an iterator on the value with this key, and 'true' iff inserted.
+      template <typename... Args>
+      std::pair<iterator, bool> emplace( Args&&... args );
+
+      /**
+       * Erases a value. Other iterators remain valid.
+       * @param pos a valid dereferenceable iterator.
+       * @return an iterator on the next value.
+       */
+      iterator erase( const_iterator pos );
+
+      /// Erases a range of values.
+      /// @param first begin of the range.
+      /// @param last end of the range.
+      /// @return @a last
+      iterator erase( const_iterator first, const_iterator last );
+
+      /// Erases the value with the given key, if any.
+      /// @param aKey any key.
+      /// @return the number of erased values (0 or 1).
+      size_type erase( const key_type & aKey );
+
+      /// @param aKey any key.
+      /// @return an iterator on the value with this key or end().
+      iterator find( const key_type & aKey );
+      /// @param aKey any key.
+      /// @return an iterator on the value with this key or end().
+      const_iterator find( const key_type & aKey ) const;
+      /// @param aKey any key.
+      /// @return the number of values with this key (0 or 1).
+      size_type count( const key_type & aKey ) const;
+      /// @param aKey any key.
+      /// @return the range of values with this key.
+      std::pair<iterator, iterator> equal_range( const key_type & aKey );
+      /// @param aKey any key.
+      /// @return the range of values with this key.
+      std::pair<const_iterator, const_iterator> equal_range( const key_type & aKey ) const;
+
+      /**
+       * Equality of two tables, independently of the order of their values.
+       * @param other any other table.
+       * @return 'true' iff they have the same values.
+       */
+      bool operator==( const FlatHashTable & other ) const;
+      /// @param other any other table.
+      /// @return 'true' iff they do not have the same values.
+      bool operator!=( const FlatHashTable & other ) const;
+
+      // ----------------------- Interface --------------------------------------
+    public:
+
+      /**
+       * Writes/Displays the object on an output stream.
+       * @param out the output stream where the object is written.
+       */
+      void selfDisplay ( std::ostream & out ) const;
+
+      /**
+       * Checks the validity/consistency of the object.
+       * @return 'true' if the object is valid, 'false' otherwise.
+       */
+      bool isValid() const;
+
+      // ------------------------- Protected services ---------------------------
+    protected:
+
+      /**
+       * Inserts a value constructed from @a args if the key @a aKey
+       * is not already in the table. The value is constructed only
+       * if it is inserted.
+       * @param aKey the key of the value.
+       * @param args the arguments of the value constructor.
+       * @return an iterator on the value with this key, and 'true' iff inserted.
+       */
+      template <typename... Args>
+      std::pair<iterator, bool> emplaceWithKey( const key_type & aKey, Args&&... args );
+
+      // ------------------------- Private services -----------------------------
+    private:
+
+      /// States of slots.
+      enum { EMPTY = 0, FULL = 1, ERASED = 2 };
+
+      /// @param h any hash value.
+      /// @return the slot where probing starts.
+      size_type firstSlot( std::size_t h ) const;
+      /// @param aKey any key.
+      /// @return the slot of this key or bucket_count() if absent.
+      size_type findSlot( const key_type & aKey ) const;
+      /// @param i a slot index.
+      /// @return an iterator on this slot.
+      iterator makeIterator( size_type i ) const;
+      /// Allocates @a n slots (a power of two, or 0).
+      void allocate( size_type n );
+      /// Destroys the values and frees the slots.
+      void deallocate();
+      /// Grows the table before inserting one more value.
+      void grow();
+      /// @param n any number of values.
+      /// @return the number of slots needed to store @a n values.
+      static size_type slotsFor( size_type n );
+
+      // ------------------------- Private Datas --------------------------------
+    private:
+      /// States of slots, followed by a full sentinel.
+      std::vector<unsigned char> myStates;
+      /// Slots (uninitialized memory when not full).
+      TValue* mySlots;
+      /// Number of slots.
+      size_type myCapacity;
+      /// Number of values.
+      size_type mySize;
+      /// Number of erased slots.
+      size_type myNbErased;
+      /// Hash functor.
+      hasher myHash;
+      /// Equality predicate.
+      key_equal myKeyEqual;
+    }; // end of class FlatHashTable
+
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatHashSet
+  /**
+     Description of template class 'FlatHashSet' <p> \brief Aim: An
+     unordered set of keys, stored in a hash table with open
+     addressing (a single array of keys, without any node).
+
+     Compared to std::unordered_set (one node and one bucket pointer per
+     key) or to std::set (one node with three pointers per key), it
+     uses less memory and is more cache friendly. It models
+     boost::ForwardContainer and is an unordered set associative
+     container for ContainerTraits.
+
+     Contrary to std::unordered_set, inserting a key invalidates
+     iterators, references and pointers to keys when the table grows.
+     Erasing a key only invalidates iterators to this key.
+
+     @tparam TKey the type of keys.
+     @tparam THash the hash functor on keys (mixed before use).
+     @tparam TKeyEqual the equality predicate on keys.
+
+     @see KhalimskyCellContainers.h for sets of cells.
+  */
+  template < typename TKey,
+             typename THash = std::hash<TKey>,
+             typename TKeyEqual = std::equal_to<TKey> >
+  class FlatHashSet
+    : public detail::FlatHashTable< TKey, detail::FlatHashSetKeyOfValue<TKey>,
+                                    THash, TKeyEqual >
+  {
+  public:
+    typedef detail::FlatHashTable< TKey, detail::FlatHashSetKeyOfValue<TKey>,
+                                   THash, TKeyEqual > Base;
+    using Base::Base;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatHashMap
+  /**
+     Description of template class 'FlatHashMap' <p> \brief Aim: An
+     unordered map, stored in a hash table with open addressing (a
+     single array of pairs (key,value), without any node).
+
+     It has the same interface as std::unordered_map (without
+     buckets), the same memory advantage and the same restrictions on
+     iterator validity as FlatHashSet. It models boost::ForwardContainer
+     and is an unordered map associative container for ContainerTraits.
+
+     @tparam TKey the type of keys.
+     @tparam TMapped the type of mapped values.
+     @tparam THash the hash functor on keys (mixed before use).
+     @tparam TKeyEqual the equality predicate on keys.
+  */
+  template < typename TKey, typename TMapped,
+             typename THash = std::hash<TKey>,
+             typename TKeyEqual = std::equal_to<TKey> >
+  class FlatHashMap
+    : public detail::FlatHashTable< std::pair<const TKey, TMapped>,
+                                    detail::FlatHashMapKeyOfValue< TKey, std::pair<const TKey, TMapped> >,
+                                    THash, TKeyEqual >
+  {
+  public:
+    typedef detail::FlatHashTable< std::pair<const TKey, TMapped>,
+                                   detail::FlatHashMapKeyOfValue< TKey, std::pair<const TKey, TMapped> >,
+                                   THash, TKeyEqual > Base;
+    typedef TMapped mapped_type;
+    typedef typename Base::key_type key_type;
+    typedef typename Base::iterator iterator;
+    using Base::Base;
+
+    /**
+     * @param aKey any key.
+     * @return a reference to the value mapped to @a aKey, which is
+     * inserted (default value) if absent.
+     */
+    mapped_type & operator[]( const key_type & aKey );
+
+    /**
+     * @param aKey any key.
+     * @return a reference to the value mapped to @a aKey, which is
+     * inserted (default value) if absent.
+     */
+    mapped_type & operator[]( key_type && aKey );
+
+    /**
+     * @param aKey any key in the map.
+     * @return a reference to the value mapped to @a aKey.
+     * @throw std::out_of_range if the key is not in the map.
+     */
+    mapped_type & at( const key_type & aKey );
+
+    /**
+     * @param aKey any key in the map.
+     * @return a const reference to the value mapped to @a aKey.
+     * @throw std::out_of_range if the key is not in the map.
+     */
+    const mapped_type & at( const key_type & aKey ) const;
+  };
+
+  /// Defines container traits for FlatHashSet<>.
+  template < typename TKey, typename THash, typename TKeyEqual >
+  struct ContainerTraits< FlatHashSet<TKey, THash, TKeyEqual> >
+  {
+    typedef UnorderedSetAssociativeCategory Category;
+  };
+
+  /// Defines container traits for FlatHashMap<>.
+  template < typename TKey, typename TMapped, typename THash, typename TKeyEqual >
+  struct ContainerTraits< FlatHashMap<TKey, TMapped, THash, TKeyEqual> >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatHashTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatHashTable' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue, typename TKeyOfValue, typename THash, typename TKeyEqual>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const detail::FlatHashTable<TValue, TKeyOfValue, THash, TKeyEqual> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/FlatHashContainers.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatHashContainers_h
+
+#undef FlatHashContainers_RECURSES
+#endif // else defined(FlatHashContainers_RECURSES)
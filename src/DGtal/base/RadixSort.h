@@ -0,0 +1,91 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file RadixSort.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module RadixSort.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(RadixSort_RECURSES)
+#error Recursive header files inclusion detected in RadixSort.h
+#else // defined(RadixSort_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RadixSort_RECURSES
+
+#if !defined RadixSort_h
+/** Prevents repeated inclusion of headers. */
+#define RadixSort_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace functions
+  {
+    /**
+     * Sorts a sequence of pairs (key, value) by increasing keys, with
+     * a least significant digit radix sort on digits of 11 bits. The
+     * sort is stable: pairs with the same key keep their relative
+     * order. Only the digits below the highest bit of the maximal key
+     * are visited, and a digit shared by all keys is skipped, so that
+     * small or packed keys (e.g. a pair of indices \a i * n + \a j) are
+     * sorted in a few linear passes.
+     *
+     * When \a parallel is 'true' and DGtal is built with OpenMP, each
+     * pass is shared by the threads: each one counts the digits of a
+     * contiguous block of the sequence, then scatters its block at
+     * offsets given by the counts of all blocks. The result does not
+     * depend on the number of threads.
+     *
+     * @tparam TValue the type of values (copyable).
+     *
+     * @param[in,out] items the sequence of pairs to sort.
+     * @param[in] parallel when 'true', the passes are parallel (with OpenMP).
+     *
+     * @note It needs a buffer of the size of \a items.
+     */
+    template <typename TValue>
+    void radixSortByKey( std::vector< std::pair< DGtal::uint64_t, TValue > > & items,
+                         bool parallel = false );
+
+  } // namespace functions
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/RadixSort.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RadixSort_h
+
+#undef RadixSort_RECURSES
+#endif // else defined(RadixSort_RECURSES)
@@ -45,6 +45,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/math/linalg/SimpleMatrix.h"
@@ -54,6 +55,7 @@
 #include "DGtal/topology/CCellFunctor.h"
 #include "DGtal/topology/CanonicSCellEmbedder.h"
 #include "DGtal/topology/SCellsFunctors.h"
+#include "DGtal/images/Morton.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -902,6 +904,16 @@ public:
               ConstAlias< DigitalKernel > fullKernel,
               ConstAlias< std::vector< PairIterators > > masks );
 
+  /**
+  * Sets the order in which eval(itbegin, itend, ...) and evalCovarianceMatrix(itbegin, itend, ...) visit the surfels.
+  * The results are output in the order of the range in both cases.
+  *
+  * @param[in] mortonOrder if true (default), the surfels are visited by increasing Morton code of their inner spel,
+  * so that consecutive surfels share the same spel or have adjacent spels, and the masks are used more often.
+  * Otherwise, they are visited in the order of the range.
+  */
+  void setMortonOrder ( bool mortonOrder );
+
   /**
   * Convolve the kernel at a position \a it.
   *
@@ -934,6 +946,9 @@ public:
   /**
   * Convolve the kernel at all positions of the range [itBegin, itEnd[ and outputs results sequentially with \a result iterator.
   *
+  * With OpenMP, the range is split into contiguous chunks evaluated in parallel, each chunk restarting the
+  * optimization with masks on its first surfel. The shape functor must then be callable from several threads.
+  *
   * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
   * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
   * @param[out] result iterator of an array where estimates quantities are set ( the estimated quantity from *itbegin till *itend (excluded)).
@@ -995,6 +1010,8 @@ public:
   /**
   * Convolve the kernel at all positions of the range [itBegin, itEnd[ and outputs results sequentially with \a result iterator.
   *
+  * With OpenMP, the range is split into contiguous chunks evaluated in parallel (see eval(itbegin, itend, result)).
+  *
   * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrix is computed.
   * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrix is computed.
   * @param[out] result iterator of an array where estimates covariance matrix are set ( the covariance matrix from *itbegin till *itend (excluded)).
@@ -1121,6 +1138,51 @@ protected:
                                    Quantity * lastInnerMoments = defaultInnerMoments,
                                    Quantity * lastOuterMoments = defaultOuterMoments ) const;
 
+  /**
+   * @brief core_evalRange method used ( in intern by eval(itbegin, itend, ...) ) to compute the Quantity on all surfels of
+   * a range, chunk by chunk (in parallel with OpenMP).
+   *
+   * @param[in] itbegin (iterator of the) first surfel of the range.
+   * @param[in] itend (iterator of the) last (excluded) surfel of the range.
+   * @param[out] result iterator where the results of \a functor are output, in the order of the range.
+   * @param[in] functor functor called with the result of the convolution (copied for each chunk).
+   *
+   * @tparam Value type of the results of \a functor.
+   */
+  template< typename Value, typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void core_evalRange ( const SurfelIterator & itbegin,
+                        const SurfelIterator & itend,
+                        OutputIterator & result,
+                        const EvalFunctor & functor ) const;
+
+  /**
+   * @brief core_evalCovarianceMatrixRange method used ( in intern by evalCovarianceMatrix(itbegin, itend, ...) ) to
+   * compute the covariance matrix on all surfels of a range, chunk by chunk (in parallel with OpenMP).
+   *
+   * @param[in] itbegin (iterator of the) first surfel of the range.
+   * @param[in] itend (iterator of the) last (excluded) surfel of the range.
+   * @param[out] result iterator where the results of \a functor are output, in the order of the range.
+   * @param[in] functor functor called with the covariance matrix (copied for each chunk).
+   *
+   * @tparam Value type of the results of \a functor.
+   */
+  template< typename Value, typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void core_evalCovarianceMatrixRange ( const SurfelIterator & itbegin,
+                                        const SurfelIterator & itend,
+                                        OutputIterator & result,
+                                        const EvalFunctor & functor ) const;
+
+  /**
+   * @brief computeChunks computes the order in which the surfels are visited and splits it into contiguous chunks.
+   *
+   * @param[in] surfels the surfels of the range.
+   * @param[out] order the indices of the surfels, in the visiting order (see setMortonOrder()).
+   * @param[out] chunks the bounds of the chunks in \a order: chunk i is [chunks[i], chunks[i+1]).
+   */
+  void computeChunks ( const std::vector< Spel > & surfels,
+                       std::vector< std::size_t > & order,
+                       std::vector< std::size_t > & chunks ) const;
+
 
   // ------------------------- Private Datas --------------------------------
 
@@ -1141,6 +1203,8 @@ private:
 
   bool isInitKernelAndMasks; ///< If the user uses init with masks and digital (full) kernel. See init() for more information.
 
+  bool isMortonOrdered; ///< If the surfels of a range are visited in Morton order. See setMortonOrder() for more information.
+
   const std::vector< PairIterators > * myMasks; ///< Pointer of vector of iterators for kernel partial masks
 
   const DigitalKernel * myKernel; ///< Two choice to iterate over the full kernel. See init() for more information.
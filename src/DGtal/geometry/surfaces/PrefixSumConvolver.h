@@ -0,0 +1,364 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PrefixSumConvolver.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module PrefixSumConvolver.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see DigitalSurfaceConvolver.h IntegralInvariantVolumeEstimator.h IntegralInvariantCovarianceEstimator.h
+ */
+
+#if defined(PrefixSumConvolver_RECURSES)
+#error Recursive header files inclusion detected in PrefixSumConvolver.h
+#else // defined(PrefixSumConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PrefixSumConvolver_RECURSES
+
+#if !defined PrefixSumConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define PrefixSumConvolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class PrefixSumConvolver
+/**
+   * Description of template class 'PrefixSumConvolver' <p>
+   * \brief Aim: Computes the convolution of a digital shape by a digital
+   * kernel at the inner and outer spels of surfels, together with the
+   * moments of order 1 and 2 of the intersection, from prefix sums of the
+   * rows of the shape. It is an alternative to DigitalSurfaceConvolver for
+   * the Integral Invariant estimators when the kernel is large.
+   *
+   * At construction, each row of the domain of the Khalimsky space (along
+   * the first axis) is scanned once and stored as its runs of points of
+   * the shape, each run knowing the sums of 1, x and x^2 over the previous
+   * runs of the row (a summed-volume table of the rows, whose size is the
+   * number of runs). The kernel, given by init(), is cut into intervals
+   * along the first axis. The volume and moments of the kernel centered on
+   * a spel are then obtained with two binary searches per interval of the
+   * kernel, whatever its length. For a ball of digital radius r in
+   * dimension d, the cost per surfel is thus O(r^(d-1) log n), n being the
+   * number of runs of a row of the shape, instead of O(r^d) evaluations of
+   * the shape (or O(r^(d-1)) with the shifting masks of
+   * DigitalSurfaceConvolver, on adjacent surfels only): it still grows with
+   * the radius, but does not depend on the order of the surfels. Moments
+   * are computed relatively to the center of the kernel with exact integer
+   * arithmetic.
+   *
+   * The result is exactly the convolution of the shape by the digital
+   * kernel given to init(). The masks of DigitalSurfaceConvolver are
+   * digitizations of differences of two shifted Euclidean balls: when
+   * lattice points lie exactly on the kernel sphere and the grid step is
+   * not a dyadic number (e.g. h = 0.1, r = 30), rounding may classify them
+   * differently in the kernel and in the masks, and both backends then
+   * differ by a few points (see testIntegralInvariantVolumeEstimator.cpp).
+   *
+   * The moments are only needed at the spels of the surface, hence they
+   * are not computed over the whole volume, e.g. by FFT (see RealFFT):
+   * this would take O(N log N) time and N doubles for each of the 10
+   * moments in 3D (N the number of points of the domain, much larger than
+   * the number of surfels), would need the optional FFTW dependency
+   * (WITH_FFTW3), and would only give rounded values of the counts.
+   *
+   * As for DigitalSurfaceConvolver, the result at a surfel is the mean of
+   * the results at its inner and outer spels. The evaluation of a range of
+   * surfels is parallel with OpenMP.
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND, the space in which the shape is defined.
+   * @tparam TPointFunctor a functor Point -> number, non zero inside the shape (e.g. a
+   * functors::PointFunctorFromPointPredicateAndDomain).
+   *
+   * @see testIntegralInvariantVolumeEstimator.cpp testIntegralInvariantCovarianceEstimator.cpp
+   */
+template< typename TKSpace, typename TPointFunctor >
+class PrefixSumConvolver
+{
+  // ----------------------- Types ------------------------------------------
+
+public:
+
+  typedef TKSpace KSpace;
+  typedef TPointFunctor PointFunctor;
+  BOOST_CONCEPT_ASSERT (( concepts::CCellularGridSpaceND< KSpace > ));
+
+  typedef typename KSpace::Space Space;
+  typedef typename KSpace::Integer Integer;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell Spel;
+  typedef HyperRectDomain< Space > Domain;
+
+  static const Dimension dimension = KSpace::dimension;
+
+  typedef double Quantity;
+  typedef SimpleMatrix< double, dimension, dimension > CovarianceMatrix;
+
+  // ----------------------- Standard services ------------------------------
+
+public:
+
+  /**
+  * Constructor. Scans the shape on the domain of \a space and builds the tables of its rows.
+  *
+  * @param[in] space space in which the shape is defined.
+  * @param[in] f a functor Point -> number, non zero inside the shape.
+  */
+  PrefixSumConvolver ( ConstAlias< KSpace > space, ConstAlias< PointFunctor > f );
+
+  /**
+  * Destructor.
+  */
+  ~PrefixSumConvolver() {}
+
+  // ----------------------- Interface --------------------------------------
+
+public:
+
+  /**
+  * Sets the kernel.
+  *
+  * @param[in] itb iterator on the first point of the kernel, relatively to its center.
+  * @param[in] ite iterator after the last point of the kernel.
+  *
+  * @tparam PointIterator type of iterator on Point.
+  */
+  template< typename PointIterator >
+  void init ( PointIterator itb, PointIterator ite );
+
+  /**
+  * Convolve the kernel at a position \a it.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the convolution is computed.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  *
+  * @return the number of points of the shape in the kernel (mean of the inner and outer spels).
+  */
+  template< typename SurfelIterator >
+  Quantity eval ( const SurfelIterator & it ) const;
+
+  /**
+  * Convolve the kernel at all positions of the range [itBegin, itEnd[ and applies the functor \a functor on results
+  * outputed sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array where the results of \a functor are set, in the order of the range.
+  * @param[in] functor functor called with the result of the convolution (copied for each thread).
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when Quantity are stored.
+  * @tparam EvalFunctor type of functor on Quantity.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void eval ( const SurfelIterator & itbegin,
+              const SurfelIterator & itend,
+              OutputIterator & result,
+              EvalFunctor functor ) const;
+
+  /**
+  * Computes the covariance matrix of the intersection of the shape and the kernel at a position \a it.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the covariance matrix is computed.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  *
+  * @return the covariance matrix at *it (mean of the inner and outer spels).
+  */
+  template< typename SurfelIterator >
+  CovarianceMatrix evalCovarianceMatrix ( const SurfelIterator & it ) const;
+
+  /**
+  * Computes the covariance matrix at all positions of the range [itBegin, itEnd[ and applies the functor \a functor
+  * on results outputed sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrix is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrix is computed.
+  * @param[out] result iterator of an array where the results of \a functor are set, in the order of the range.
+  * @param[in] functor functor called with the covariance matrix (copied for each thread).
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when Quantity are stored.
+  * @tparam EvalFunctor type of functor on CovarianceMatrix.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalCovarianceMatrix ( const SurfelIterator & itbegin,
+                              const SurfelIterator & itend,
+                              OutputIterator & result,
+                              EvalFunctor functor ) const;
+
+  /**
+   * @return the number of runs of the shape stored in the tables.
+   */
+  std::size_t nbRuns () const;
+
+  /**
+   * Writes/Displays the object on an output stream.
+   * @param out the output stream where the object is written.
+   */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+   * Checks the validity/consistency of the object.
+   * @return 'true' if the object is valid, 'false' otherwise.
+   */
+  bool isValid() const;
+
+  // ------------------------- Internal types -------------------------------
+
+protected:
+
+  /// A run [begin, end) of points of the shape along a row, with the sums of 1, x and x^2 over the previous runs of the row.
+  struct Run
+  {
+    Integer begin;         ///< first coordinate of the run (relative to the lower bound of the domain)
+    Integer end;           ///< coordinate after the run
+    DGtal::int64_t sums[ 3 ]; ///< sums of x^k over the previous runs of the row, for k = 0, 1, 2
+  };
+
+  /// An interval [begin, end] of the kernel along the first axis, on the row of given offset.
+  struct KernelRow
+  {
+    Point offset;  ///< offset of the row (first coordinate is 0)
+    Integer begin; ///< first coordinate of the interval
+    Integer end;   ///< last coordinate of the interval
+  };
+
+  /// Moments of order 0, 1 and 2, relatively to the center of the kernel.
+  struct Moments
+  {
+    DGtal::int64_t m0;                         ///< sum of 1
+    DGtal::int64_t m1[ dimension ];            ///< sums of x_i
+    DGtal::int64_t m2[ dimension ][ dimension ]; ///< sums of x_i x_j (i <= j)
+  };
+
+  // ------------------------- Internals ------------------------------------
+
+protected:
+
+  /**
+   * Computes the sums of x^k over the points of the shape of a row whose coordinate is lower than \a t.
+   *
+   * @param[in] row the index of the row.
+   * @param[in] t a coordinate along the row (relative to the lower bound of the domain), in [0, width].
+   * @param[out] sums the sums, for k = 0, 1, 2.
+   */
+  void prefixSums ( std::size_t row, Integer t, DGtal::int64_t sums[ 3 ] ) const;
+
+  /**
+   * Computes the moments of the intersection of the shape and the kernel centered on a spel.
+   *
+   * @param[in] spel the center of the kernel.
+   * @param[in] withMoments if false, only the moment of order 0 is computed.
+   * @param[out] moments the moments.
+   */
+  void spelMoments ( const Spel & spel, bool withMoments, Moments & moments ) const;
+
+  /**
+   * @param[in] moments the moments of order 0, 1 and 2.
+   * @return the covariance matrix of these moments.
+   */
+  CovarianceMatrix covarianceMatrix ( const Moments & moments ) const;
+
+  // ------------------------- Private Datas --------------------------------
+
+private:
+
+  const KSpace & myKSpace; ///< Const ref of the shape Kspace
+
+  Point myLowerBound; ///< Lower bound of the domain
+
+  Point myUpperBound; ///< Upper bound of the domain
+
+  std::vector< std::size_t > myRowBegins; ///< Index of the first run of each row (and end of the last row)
+
+  std::vector< Run > myRuns; ///< Runs of all rows
+
+  std::vector< KernelRow > myKernelRows; ///< Intervals of the kernel
+
+  // ------------------------- Hidden services ------------------------------
+
+private:
+
+  /**
+  * Copy constructor.
+  * @param other the object to clone.
+  * Forbidden by default.
+  */
+  PrefixSumConvolver ( const PrefixSumConvolver & other );
+
+  /**
+  * Assignment.
+  * @param other the object to copy.
+  * @return a reference on 'this'.
+  * Forbidden by default.
+  */
+  PrefixSumConvolver & operator= ( const PrefixSumConvolver & other );
+
+  /**
+   * @param[in] p a point of the domain (its first coordinate is ignored).
+   * @return the index of the row of \a p.
+   */
+  std::size_t rowIndex ( const Point & p ) const;
+
+}; // end of class PrefixSumConvolver
+
+
+/**
+   * Overloads 'operator<<' for displaying objects of class 'PrefixSumConvolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PrefixSumConvolver' to write.
+   * @return the output stream after the writing.
+   */
+template< typename TKSpace, typename TPointFunctor >
+std::ostream&
+operator<< ( std::ostream & out, const PrefixSumConvolver< TKSpace, TPointFunctor > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/PrefixSumConvolver.ih"
+
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PrefixSumConvolver_h
+
+#undef PrefixSumConvolver_RECURSES
+#endif // else defined(PrefixSumConvolver_RECURSES)
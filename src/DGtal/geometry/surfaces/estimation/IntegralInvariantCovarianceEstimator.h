@@ -56,6 +56,7 @@
 #include "DGtal/shapes/Shapes.h"
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
+#include "DGtal/geometry/surfaces/PrefixSumConvolver.h"
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
@@ -88,6 +89,12 @@ namespace DGtal
 * IntegralInvariantVolumeEstimator instead when trying to estimate the
 * 2D curvature or the mean curvature.
 *
+* For large radii, the covariance matrix may instead be computed from prefix sums
+* of the rows of the shape (see PrefixSumConvolver and setParams()):
+* the cost per surfel is then O(r^(d-1) log n) for a kernel of radius
+* r (still growing with the radius), and does not depend on the order
+* of the surfels.
+*
 * @tparam TKSpace a model of CCellularGridSpaceND, the cellular space
 * in which the shape is defined.
 *
@@ -155,6 +162,7 @@ public:
 
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, 
                                   KSpace, DigitalShapeKernel> Convolver;
+  typedef PrefixSumConvolver< KSpace, ShapePointFunctor > PrefixSums;
   typedef typename Convolver::PairIterators PairIterators;
   typedef typename Convolver::CovarianceMatrix Matrix;
   typedef typename Matrix::Component Component;
@@ -230,11 +238,15 @@ public:
                ConstAlias<PointPredicate> aPointPredicate );
 
   /**
-  * Set specific parameters: the radius of the ball.
+  * Set specific parameters: the radius of the ball and the convolution backend.
   *
   * @param[in] dRadius the "digital" radius of the kernel (but may be non integer).
+  * @param[in] prefixSums when 'true', the covariance matrix is computed from
+  * prefix sums of the rows of the shape (PrefixSumConvolver), whose
+  * tables are built by init() over the domain of the Khalimsky space;
+  * otherwise (default) by DigitalSurfaceConvolver and its shifting masks.
   */
-  void setParams( const double dRadius );
+  void setParams( const double dRadius, bool prefixSums = false );
   
   /**
   * Model of CDigitalSurfaceLocalEstimator. Initialisation.
@@ -316,6 +328,9 @@ private:
   CountedPtr<ShapePointFunctor>  myShapePointFunctor; ///< Smart pointer on functor point -> {0,1}
   CountedPtr<ShapeSpelFunctor>   myShapeSpelFunctor;  ///< Smart pointer on functor spel ->  {0,1}
   CountedPtr<Convolver>          myConvolver;   ///< Convolver
+  CountedConstPtrOrConstPtr<KSpace> myKSpace;   ///< Smart pointer (if required) on the cellular grid space.
+  CountedPtr<PrefixSums>         myPrefixSums;  ///< Prefix sums convolver, built by init() if required
+  bool myUsePrefixSums;                     ///< if the covariance matrix is computed with prefix sums of rows
   Scalar myH;                               ///< precision of the grid
   Scalar myRadius;                          ///< "digital" radius of the kernel (but may be non integer).
 
@@ -0,0 +1,415 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompactVoronoiMap.h
+ * @brief Linear in time Voronoi map and distance transformation
+ * storing a linearized site index per point.
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testCompactVoronoiMap.cpp
+ */
+
+#if defined(CompactVoronoiMap_RECURSES)
+#error Recursive header files inclusion detected in CompactVoronoiMap.h
+#else // defined(CompactVoronoiMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompactVoronoiMap_RECURSES
+
+#if !defined CompactVoronoiMap_h
+/** Prevents repeated inclusion of headers. */
+#define CompactVoronoiMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompactVoronoiMap
+  /**
+   * Description of template class 'CompactVoronoiMap' <p>
+   * \brief Aim: Implementation of the linear in time Voronoi map
+   * construction storing, for each point, the linearized index of its
+   * closest site instead of the site itself.
+   *
+   * The separable process is the one of VoronoiMap (see @cite
+   * Maurer2003PAMI @cite dcoeurjo_these) and any model of
+   * concepts::CSeparableMetric can be used. The difference lies in the
+   * storage: VoronoiMap keeps a full Point per domain point whereas
+   * this class keeps a single TSiteIndex integer (32 bits by
+   * default), the linearized index of the site in the domain. In
+   * dimension 3 with 32-bit coordinates, this divides the memory
+   * footprint of the map by three. Sites are decoded on the fly along
+   * each 1D line during the computation.
+   *
+   * When only distances are needed, the raw distances (e.g. squared
+   * distances for the @f$ l_2@f$ metric) or the distances can be
+   * written into a caller-provided scalar image with rawDistances()
+   * and distances(), after which the CompactVoronoiMap instance can be
+   * released.
+   *
+   * The site indices are not optional: this is not a distance-only
+   * (Meijster or Saito) transform. Such a transform propagates partial
+   * distances from one dimension to the next, which requires the
+   * metric to be written as a sum of one-dimensional terms, whereas a
+   * concepts::CSeparableMetric only compares sites (hiddenBy,
+   * closest). Keeping the generic metrics, the peak memory is one
+   * SiteIndex per point during the computation, plus the
+   * caller-provided scalar image once the distances are exported.
+   *
+   * As VoronoiMap, the 1D problems along dimensions other than the
+   * first one are solved by tiles of lines adjacent along the first
+   * dimension, the index storage being contiguous along it.
+   *
+   * Only non-periodic domains are supported: sites are encoded as
+   * indices in the domain.
+   *
+   * This class is a model of concepts::CConstImage (the value at a
+   * point being the Voronoi site, as for VoronoiMap).
+   *
+   * @tparam TSpace type of Digital Space (model of concepts::CSpace).
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of concepts::CPointPredicate)
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric
+   * @tparam TSiteIndex unsigned integer type used to store the site
+   * indices (default: DGtal::uint32_t). The number of points of the
+   * domain must not exceed the maximal value of this type (checked
+   * at construction): e.g. use DGtal::uint64_t for domains of 2^32
+   * points or more.
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric,
+             typename TSiteIndex = DGtal::uint32_t >
+  class CompactVoronoiMap
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+
+    ///Both Space points and PointPredicate points must be the same.
+    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Point,
+                          typename TPointPredicate::Point >::value ));
+
+    ///Site indices must be unsigned integers.
+    BOOST_STATIC_ASSERT (( boost::is_integral< TSiteIndex >::value ));
+    BOOST_STATIC_ASSERT (( boost::is_unsigned< TSiteIndex >::value ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Copy of the point predicate type.
+    typedef TPointPredicate PointPredicate;
+
+    ///Definition of the underlying domain type.
+    typedef HyperRectDomain<Space> Domain;
+
+    ///Definition of the separable metric type
+    typedef TSeparableMetric SeparableMetric;
+
+    ///Site index type.
+    typedef TSiteIndex SiteIndex;
+
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    typedef typename Space::Point::Coordinate Abscissa;
+
+    ///Definition of the image value type.
+    typedef Vector Value;
+
+    ///Self type
+    typedef CompactVoronoiMap< TSpace, TPointPredicate,
+                               TSeparableMetric, TSiteIndex > Self;
+
+    ///Definition of the image constRange
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    /// Number of lines (along the first dimension) processed together
+    /// by the cache-blocked pass.
+    static const Size TileWidth = 16;
+
+    /// Index of points without site (no site in the domain).
+    static const SiteIndex NoSite = static_cast<SiteIndex>( -1 );
+
+    /**
+     * Constructor.
+     *
+     * This constructor computes the Voronoi Map of a set of point
+     * sites using a SeparableMetric metric, on a non-periodic domain.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     *
+     * @param predicate a pointer to the point predicate to define the
+     * Voronoi sites (false points).
+     *
+     * @param aMetric a pointer to the separable metric instance.
+     *
+     * @throw std::length_error if the number of points of the domain
+     * exceeds the maximal value of SiteIndex.
+     */
+    CompactVoronoiMap(ConstAlias<Domain> aDomain,
+                      ConstAlias<PointPredicate> predicate,
+                      ConstAlias<SeparableMetric> aMetric);
+
+    /**
+     * Default destructor
+     */
+    ~CompactVoronoiMap() = default;
+
+    /**
+     * Disabling default constructor.
+     */
+    CompactVoronoiMap() = delete;
+
+  public:
+    // ------------------- ConstImage model ------------------------
+
+    /**
+     * Returns a reference (const) to the Voronoi map domain.
+     * @return a domain
+     */
+    const Domain &  domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * Returns a const range on the Voronoi map values.
+     *  @return a const range
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * Access to a Voronoi value (the closest site) at a point.
+     *
+     * @pre at least one site exists in the domain.
+     * @param aPoint the point to probe.
+     * @return the closest site.
+     */
+    Value operator()(const Point &aPoint) const
+    {
+      return site( siteIndex( aPoint ) );
+    }
+
+    // ------------------- Compact storage services ------------------------
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the linearized index of the closest site of @a aPoint
+     * (or NoSite if the domain does not contain any site).
+     */
+    SiteIndex siteIndex( const Point & aPoint ) const
+    {
+      return myIndices[ linearized( aPoint ) ];
+    }
+
+    /**
+     * @param anIndex a site index (different from NoSite).
+     * @return the site point.
+     */
+    Point site( const SiteIndex anIndex ) const
+    {
+      ASSERT( anIndex != NoSite );
+      Point p = myLowerBound;
+      std::size_t index = static_cast<std::size_t>( anIndex );
+      for ( Dimension k = 0; k < Space::dimension; ++k )
+        {
+          p[k] += static_cast<Abscissa>( index % static_cast<std::size_t>( myExtent[k] ) );
+          index /= static_cast<std::size_t>( myExtent[k] );
+        }
+      return p;
+    }
+
+    /**
+     * @return the site indices, in the linearized order of the domain.
+     */
+    const std::vector<SiteIndex> & siteIndices() const
+    {
+      return myIndices;
+    }
+
+    /**
+     * Writes the raw distance (e.g. squared distance for the @f$
+     * l_2@f$ metric) to the closest site in a scalar image.
+     *
+     * @tparam TImage a model of concepts::CImage whose domain contains
+     * the Voronoi map domain and whose value type is constructible
+     * from SeparableMetric::RawValue.
+     *
+     * @param [out] anImage the image to fill.
+     * @param [in] aFarValue the value written at points without site.
+     */
+    template <typename TImage>
+    void rawDistances( TImage & anImage,
+                       const typename TImage::Value aFarValue = typename TImage::Value() ) const;
+
+    /**
+     * Writes the distance to the closest site in a scalar image.
+     *
+     * @tparam TImage a model of concepts::CImage whose domain contains
+     * the Voronoi map domain and whose value type is constructible
+     * from SeparableMetric::Value.
+     *
+     * @param [out] anImage the image to fill.
+     * @param [in] aFarValue the value written at points without site.
+     */
+    template <typename TImage>
+    void distances( TImage & anImage,
+                    const typename TImage::Value aFarValue = typename TImage::Value() ) const;
+
+    /**
+     * @return Returns an alias to the underlying metric.
+     */
+    const SeparableMetric* metric() const
+    {
+      return myMetricPtr;
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /**
+     * Compute the Voronoi Map of a set of point sites using a
+     * SeparableMetric metric.
+     */
+    void compute ( ) ;
+
+    /// Scratch buffers of computeTile. They are allocated by the
+    /// first tile and only reused afterwards.
+    struct TileBuffers
+    {
+      std::vector<Point> startPoints;     ///< First point of each lane.
+      std::vector<Point> endPoints;       ///< Last point of each lane.
+      std::vector<Point> sites;           ///< Site stacks of the lanes.
+      std::vector<SiteIndex> siteIndices; ///< Indices of the stacked sites.
+      std::vector<std::size_t> nbSites;   ///< Stack sizes.
+      std::vector<std::size_t> siteIds;   ///< Current site of each lane.
+      std::vector<Point> points;          ///< Current point of each lane.
+    };
+
+    /**
+     * Given a voronoi map valid at dimension @a dim-1, this method
+     * updates the map to make it consistent at dimension @a dim along
+     * the @a width 1D spans starting at @a row, @a row + e_0, ...
+     *
+     * @param [in] row starting point of the first 1D span.
+     * @param [in] dim dimension of the update.
+     * @param [in] width number of 1D spans (1 if @a dim is 0).
+     * @param [in,out] buffers scratch buffers, reused from one tile
+     * to the next (one instance per thread).
+     */
+    void computeTile ( const Point & row, const Dimension dim,
+                       const std::size_t width, TileBuffers & buffers );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its index in the linearized order of the domain, computed
+     * with std::size_t whatever the Size of the space.
+     */
+    std::size_t linearized( const Point & aPoint ) const
+    {
+      std::size_t index = 0;
+      for ( Dimension k = 0; k < Space::dimension; ++k )
+        index += static_cast<std::size_t>( aPoint[k] - myLowerBound[k] ) * myStrides[k];
+      return index;
+    }
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the computation domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    ///Copy of the domain lower bound
+    Point myLowerBound;
+
+    ///Copy of the domain upper bound
+    Point myUpperBound;
+
+    ///Domain extent.
+    Point myExtent;
+
+    ///Offset between two consecutive points along each dimension.
+    std::vector<std::size_t> myStrides;
+
+    ///Site indices (in the linearized order of the domain).
+    std::vector<SiteIndex> myIndices;
+
+  }; // end of class CompactVoronoiMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompactVoronoiMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompactVoronoiMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P, typename Sep, typename TI>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompactVoronoiMap<S,P,Sep,TI> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/CompactVoronoiMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompactVoronoiMap_h
+
+#undef CompactVoronoiMap_RECURSES
+#endif // else defined(CompactVoronoiMap_RECURSES)
@@ -0,0 +1,467 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FIM.h
+ *
+ * @date 2026/10/16
+ *
+ * @brief Fast Iterative Method: parallel alternative to the Fast
+ * Marching Method for incremental distance transform
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see FMM.h
+ * @see testFIM.cpp
+ */
+
+#if defined(FIM_RECURSES)
+#error Recursive header files inclusion detected in FIM.h
+#else // defined(FIM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FIM_RECURSES
+
+#if !defined FIM_h
+/** Prevents repeated inclusion of headers. */
+#define FIM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <unordered_set>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/CPointFunctor.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FIM
+  /**
+   * Description of template class 'FIM' <p>
+   * \brief Aim: Fast Iterative Method (FIM) for nd distance
+   * transforms, a multi-threaded alternative to FMM.
+   *
+   * As in FMM, a signed distance function is computed at each digital
+   * point from an initial set of points, for which the values of the
+   * signed distance are known (the @e source points, which are never
+   * modified), and the distance value of a point is computed from the
+   * distance values of its neighbors by a point functor
+   * (L2FirstOrderLocalDistance by default, L2SecondOrderLocalDistance,
+   * L1LocalDistance or LInfLocalDistance).
+   *
+   * However, instead of accepting the points one by one in increasing
+   * order of their distance values, the method of Jeong and Whitaker
+   * (A fast iterative method for eikonal equations, SIAM J. Sci.
+   * Comput., 2008) maintains a list of @e active points, all updated
+   * at each iteration:
+   * - the new distance values of all active points are computed in
+   * parallel (with OpenMP if available) by copies of the point
+   * functor, the image and the set being only read,
+   * - then these values are stored, in the order of the list. A point
+   * remains active while its (absolute) value decreases by more than
+   * a given tolerance. Otherwise, it is removed from the list and its
+   * neighbors whose value can be decreased are added to the list.
+   *
+   * Since the values are computed from the values of the previous
+   * iteration only, the result does not depend on the number of
+   * threads. At convergence, it matches the result of FMM up to the
+   * tolerance for the provided point functors. All the points whose
+   * (absolute) distance value is below a given threshold are
+   * reached.
+   *
+   * Contrary to FMM, the neighbors of a point may not have converged
+   * when its value is computed. Hence the copies of
+   * L2SecondOrderLocalDistance and LInfLocalDistance used by FIM
+   * ignore the neighbors that are not upwind (see their method
+   * setUpwindOnly); the point functor given at construction is not
+   * modified.
+   *
+   * The image and the set are written sequentially between two
+   * parallel evaluations, hence any models of CImage and CDigitalSet
+   * can be used, as for FMM, provided that their const methods can be
+   * concurrently called.
+   *
+   * @tparam TImage  any model of CImage
+   * @tparam TSet  any model of CDigitalSet
+   * @tparam TPointPredicate  any model of concepts::CPointPredicate,
+   * used to bound the computation within a domain
+   * @tparam TPointFunctor  any model of CPointFunctor,
+   * used to compute the new distance value
+   *
+   * @see FMM
+   * @see testFIM.cpp
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+  class FIM
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+
+    //concept assert
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImage> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<TSet> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointFunctor<TPointFunctor> ));
+
+    typedef TImage Image;
+    typedef TSet AcceptedPointSet;
+    typedef TPointPredicate PointPredicate;
+
+    //points
+    typedef typename Image::Point Point;
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename AcceptedPointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    //dimension
+    typedef typename Point::Dimension Dimension;
+    static const Dimension dimension;
+
+    //distance
+    typedef TPointFunctor PointFunctor;
+    typedef typename PointFunctor::Value Value;
+
+  private:
+
+    //intern data types
+    typedef std::vector<Point> Points;
+    typedef std::vector<Value> Values;
+    typedef std::unordered_set<Point> PointHashSet;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Reference on the image
+     */
+    Image& myImage;
+
+    /**
+     * Reference on the set of points having a distance value
+     */
+    AcceptedPointSet& myAcceptedPoints;
+
+    /**
+     * Initial points (whose values are never modified)
+     */
+    PointHashSet mySourcePoints;
+
+    /**
+     * List of active points
+     */
+    Points myActivePoints;
+
+    /**
+     * Pointer on the point functor used to deduce
+     * the distance of a point
+     * from the distance of its neighbors
+     */
+    PointFunctor* myPointFunctorPtr;
+
+    /**
+     * 'true' if @a myPointFunctorPtr is an owning pointer
+     * (default case), 'false' if it is an aliasing pointer
+     * on a point functor given at construction
+     */
+    const bool myFlagIsOwning;
+
+    /**
+     * Constant reference on a point predicate that returns
+     * 'true' inside the domain
+     * where the distance transform is performed
+     */
+    const PointPredicate& myPointPredicate;
+
+    /**
+     * Value threshold above which the propagation stops
+     */
+    Value myValueThreshold;
+
+    /**
+     * Decrease of the absolute value of a point
+     * below which the point is considered as converged
+     */
+    double myTolerance;
+
+    /**
+     * Number of performed iterations
+     */
+    unsigned int myNbIterations;
+
+    /**
+     * Min value
+     */
+    Value myMinValue;
+
+    /**
+     * Max value
+     */
+    Value myMaxValue;
+
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of points having a distance value,
+     * initialized with the source points
+     * @param aPointPredicate a point predicate bounding the computation
+     *
+     * @see init
+     */
+    FIM(Image& aImg, AcceptedPointSet& aSet,
+        ConstAlias<PointPredicate> aPointPredicate);
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of points having a distance value,
+     * initialized with the source points
+     * @param aPointPredicate a point predicate bounding the computation
+     * @param aValueThreshold value threshold above which the
+     * propagation stops
+     * @param aTolerance decrease of the absolute value below which a
+     * point is considered as converged
+     *
+     * @see init
+     */
+    FIM(Image& aImg, AcceptedPointSet& aSet,
+        ConstAlias<PointPredicate> aPointPredicate,
+        const Value& aValueThreshold, double aTolerance = 1e-6);
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of points having a distance value,
+     * initialized with the source points
+     * @param aPointPredicate a point predicate bounding the computation
+     * @param aPointFunctor the point functor, which is copied once
+     * per thread
+     *
+     * @see init
+     */
+    FIM(Image& aImg, AcceptedPointSet& aSet,
+        ConstAlias<PointPredicate> aPointPredicate,
+        PointFunctor& aPointFunctor );
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image
+     * @param aSet the set of points having a distance value,
+     * initialized with the source points
+     * @param aPointPredicate a point predicate bounding the computation
+     * @param aValueThreshold value threshold above which the
+     * propagation stops
+     * @param aTolerance decrease of the absolute value below which a
+     * point is considered as converged
+     * @param aPointFunctor the point functor, which is copied once
+     * per thread
+     *
+     * @see init
+     */
+    FIM(Image& aImg, AcceptedPointSet& aSet,
+        ConstAlias<PointPredicate> aPointPredicate,
+        const Value& aValueThreshold, double aTolerance,
+        PointFunctor& aPointFunctor );
+
+    /**
+     * Destructor.
+     */
+    ~FIM();
+
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computation of the signed distance function by iterating
+     * over the list of active points until it is empty.
+     *
+     * @see computeOneStep
+     */
+    void compute();
+
+    /**
+     * Performs one iteration: updates the distance values of all the
+     * active points and then the list of active points.
+     *
+     * @return 'true' if the list of active points is not empty
+     * after the iteration, 'false' otherwise.
+     */
+    bool computeOneStep();
+
+    /**
+     * @return the number of active points.
+     */
+    std::size_t nbActivePoints() const;
+
+    /**
+     * @return the number of performed iterations.
+     */
+    unsigned int nbIterations() const;
+
+    /**
+     * Minimal distance value in the set of points
+     * (exact after compute()).
+     *
+     * @return minimal distance value.
+     */
+    Value min() const;
+
+    /**
+     * Maximal distance value in the set of points
+     * (exact after compute()).
+     *
+     * @return maximal distance value
+     */
+    Value max() const;
+
+    /**
+     * Computes the minimal distance value in the set of points.
+     *
+     * @return minimal distance value.
+     */
+    Value getMin() const;
+
+    /**
+     * Computes the maximal distance value in the set of points.
+     *
+     * @return maximal distance value.
+     */
+    Value getMax() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    FIM ( const FIM & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    FIM & operator= ( const FIM & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Stores the source points and initializes the list of
+     * active points with their neighbors.
+     */
+    void init();
+
+    /**
+     * Computes, possibly in parallel, the distance values of
+     * the points of @a aPoints from the current values
+     * of their neighbors. Neither the image nor the set is modified.
+     *
+     * @param aPoints the points (with at least one neighbor in the set)
+     * @param aValues (returned) their distance values
+     */
+    void evaluate(const Points& aPoints, Values& aValues) const;
+
+    /**
+     * Stores @a aValue at @a aPoint if @a aPoint has no value yet
+     * and @a aValue is below the value threshold, or if
+     * @a aValue decreases its absolute value.
+     *
+     * @param aPoint any point
+     * @param aValue its new distance value
+     *
+     * @return 'true' if @a aPoint had no value or if its absolute
+     * value decreased by more than the tolerance, 'false' otherwise.
+     */
+    bool store(const Point& aPoint, const Value& aValue);
+
+    /**
+     * Adds to @a aPoints the neighbors of @a aPoint that lie within
+     * the domain, are not source points and do not belong to
+     * @a aMarks, which is updated.
+     *
+     * @param aPoint any point
+     * @param aPoints (returned) list of points
+     * @param aMarks set of the points of @a aPoints
+     */
+    void addNeighbors(const Point& aPoint, Points& aPoints,
+                      PointHashSet& aMarks) const;
+
+  }; // end of class FIM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FIM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FIM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const FIM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FIM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FIM_h
+
+#undef FIM_RECURSES
+#endif // else defined(FIM_RECURSES)
@@ -0,0 +1,446 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FMMCandidateQueues.h
+ *
+ * @date 2026/10/16
+ *
+ * @brief Priority queues of candidate points used by FMM.
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see FMM.h
+ * @see testFMM.cpp
+ */
+
+#if defined(FMMCandidateQueues_RECURSES)
+#error Recursive header files inclusion detected in FMMCandidateQueues.h
+#else // defined(FMMCandidateQueues_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FMMCandidateQueues_RECURSES
+
+#if !defined FMMCandidateQueues_h
+/** Prevents repeated inclusion of headers. */
+#define FMMCandidateQueues_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cmath>
+#include <set>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueCompare
+  /**
+   * Description of template class 'PointValueCompare' <p>
+   * \brief Aim: Small binary predicate to order candidates points
+   * according to their (absolute) distance value.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueCompare {
+    public:
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if a < b but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+	if ( std::abs(a.second) == std::abs(b.second) )
+	  { //point comparison
+	    return (a.first < b.first);
+	  }
+	else //distance comparison
+	  //(in absolute value in order to deal with
+	  //signed distance values)
+	  return ( std::abs(a.second) < std::abs(b.second) );
+      }
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMSetCandidateQueue
+  /**
+   * Description of template class 'FMMSetCandidateQueue' <p>
+   * \brief Aim: Candidate point queue of FMM based on a STL set of
+   * pairs (point, tentative value) ordered by absolute value, then by
+   * point.
+   *
+   * A point may be stored several times with different tentative
+   * values: FMM ignores a point popped after its acceptance.
+   *
+   * Like all candidate queues of FMM, this class provides the
+   * following services: setBounds(), clear(), empty(), size(),
+   * push(), top() and pop().
+   *
+   * Every push costs a node allocation and a tree rebalancing, but
+   * this queue is exact and deterministic. It is the default
+   * candidate queue of FMM.
+   *
+   * @tparam TPoint a point type.
+   * @tparam TValue a (signed) distance value type.
+   *
+   * @see FMMIndexedHeapCandidateQueue
+   * @see FMMUntidyCandidateQueue
+   */
+  template <typename TPoint, typename TValue>
+  class FMMSetCandidateQueue
+  {
+  public:
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+
+    /**
+     * Bounds of the candidate points (no effect for this queue).
+     * @param aLowerBound lower bound of the candidate points.
+     * @param aUpperBound upper bound of the candidate points.
+     */
+    void setBounds( const Point & aLowerBound, const Point & aUpperBound )
+    {
+      boost::ignore_unused_variable_warning( aLowerBound );
+      boost::ignore_unused_variable_warning( aUpperBound );
+    }
+
+    /// Removes all candidates.
+    void clear()
+    {
+      mySet.clear();
+    }
+
+    /// @return 'true' if there is no candidate.
+    bool empty() const
+    {
+      return mySet.empty();
+    }
+
+    /// @return the number of stored candidates.
+    std::size_t size() const
+    {
+      return mySet.size();
+    }
+
+    /**
+     * Inserts a candidate.
+     * @param aPair a pair (point, tentative value).
+     */
+    void push( const PointValue & aPair )
+    {
+      mySet.insert( aPair );
+    }
+
+    /// @return the candidate of min absolute value.
+    const PointValue & top() const
+    {
+      ASSERT( ! empty() );
+      return *mySet.begin();
+    }
+
+    /// Removes the candidate of min absolute value.
+    void pop()
+    {
+      ASSERT( ! empty() );
+      mySet.erase( mySet.begin() );
+    }
+
+  private:
+    /// Set of candidates.
+    std::set< PointValue, detail::PointValueCompare<PointValue> > mySet;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMIndexedHeapCandidateQueue
+  /**
+   * Description of template class 'FMMIndexedHeapCandidateQueue' <p>
+   * \brief Aim: Candidate point queue of FMM based on an indexed
+   * d-ary heap (d = arity) with a decrease-key operation.
+   *
+   * Each point is stored at most once: the heap position of each
+   * point is kept in a dense array indexed by the points of the box
+   * given to setBounds(), so that pushing an already stored point
+   * with a smaller tentative value only moves it up in the heap,
+   * whereas pushing it with a greater value has no effect.
+   * Candidates are ordered as in FMMSetCandidateQueue (absolute
+   * value, then point), hence the same points are accepted with the
+   * same values.
+   *
+   * The heap and the index are contiguous arrays, so that no
+   * allocation occurs per push once the heap storage is large
+   * enough. The index costs one std::size_t per point of the box,
+   * which FMM sets to the domain of its set of accepted points.
+   *
+   * @tparam TPoint a point type (model of PointVector).
+   * @tparam TValue a (signed) distance value type.
+   */
+  template <typename TPoint, typename TValue>
+  class FMMIndexedHeapCandidateQueue
+  {
+  public:
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+
+    /// Arity of the heap.
+    static const std::size_t arity = 4;
+
+    /**
+     * Sets the bounds of the candidate points and allocates the
+     * index. Must be called before any push. Removes all candidates.
+     * @param aLowerBound lower bound of the candidate points.
+     * @param aUpperBound upper bound of the candidate points.
+     */
+    void setBounds( const Point & aLowerBound, const Point & aUpperBound );
+
+    /// Removes all candidates.
+    void clear();
+
+    /// @return 'true' if there is no candidate.
+    bool empty() const
+    {
+      return myHeap.empty();
+    }
+
+    /// @return the number of stored candidates.
+    std::size_t size() const
+    {
+      return myHeap.size();
+    }
+
+    /**
+     * Inserts a candidate or decreases its tentative value if it is
+     * already stored with a greater value.
+     * @param aPair a pair (point, tentative value).
+     */
+    void push( const PointValue & aPair );
+
+    /// @return the candidate of min absolute value.
+    const PointValue & top() const
+    {
+      ASSERT( ! empty() );
+      return myHeap.front();
+    }
+
+    /// Removes the candidate of min absolute value.
+    void pop();
+
+  private:
+    /**
+     * Moves up the element at position @a i.
+     * @param i a heap position.
+     */
+    void siftUp( std::size_t i );
+
+    /**
+     * Moves down the element at position @a i.
+     * @param i a heap position.
+     */
+    void siftDown( std::size_t i );
+
+    /**
+     * Places @a aPair at position @a i and updates its index.
+     * @param i a heap position.
+     * @param aPair a pair (point, tentative value).
+     */
+    void place( std::size_t i, const PointValue & aPair );
+
+    /**
+     * @param aPoint a point within the bounds.
+     * @return the index of @a aPoint in the box of the bounds.
+     */
+    std::size_t linearized( const Point & aPoint ) const;
+
+  private:
+    /// Position index of the points that are not in the heap.
+    static const std::size_t npos = static_cast<std::size_t>( -1 );
+
+    /// Heap of candidates.
+    std::vector<PointValue> myHeap;
+    /// Heap position of each point of the box (npos if not stored).
+    std::vector<std::size_t> myPositions;
+    /// Lower bound of the box.
+    Point myLowerBound;
+    /// Upper bound of the box.
+    Point myUpperBound;
+    /// Comparator.
+    detail::PointValueCompare<PointValue> myLess;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMUntidyCandidateQueue
+  /**
+   * Description of template class 'FMMUntidyCandidateQueue' <p>
+   * \brief Aim: Candidate point queue of FMM based on an untidy
+   * bucketed priority queue.
+   *
+   * Candidates are stored in buckets of fixed width on their absolute
+   * value. Within a bucket, candidates are popped in FIFO order, and
+   * candidates pushed below the current bucket are put in the current
+   * bucket. Push and pop are thus in (amortized) constant time, but
+   * the queue is only approximately ordered: the error on the order
+   * is bounded by the bucket width, which induces an error of the
+   * same order on the computed distances (see Yatziv, Bartesaghi and
+   * Sapiro, O(N) implementation of the fast marching algorithm, 2006).
+   *
+   * The best tentative value of each point is kept in a hash map:
+   * pushing a point with a greater value has no effect, and entries
+   * that have been superseded by a smaller value are skipped.
+   *
+   * @tparam TPoint a point type.
+   * @tparam TValue a (signed) distance value type.
+   */
+  template <typename TPoint, typename TValue>
+  class FMMUntidyCandidateQueue
+  {
+  public:
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+
+    /**
+     * Constructor.
+     * @param aBucketWidth width of the buckets (default: 1 for integer
+     * values, 1/8 otherwise).
+     */
+    FMMUntidyCandidateQueue( double aBucketWidth = defaultBucketWidth() )
+      : myBucketWidth( aBucketWidth ), myFirstKey( 0 )
+    {
+      ASSERT( aBucketWidth > 0 );
+    }
+
+    /// @return the default bucket width.
+    static double defaultBucketWidth()
+    {
+      return std::is_integral<Value>::value ? 1.0 : 0.125;
+    }
+
+    /// @return the bucket width.
+    double bucketWidth() const
+    {
+      return myBucketWidth;
+    }
+
+    /**
+     * Bounds of the candidate points (no effect for this queue).
+     * @param aLowerBound lower bound of the candidate points.
+     * @param aUpperBound upper bound of the candidate points.
+     */
+    void setBounds( const Point & aLowerBound, const Point & aUpperBound )
+    {
+      boost::ignore_unused_variable_warning( aLowerBound );
+      boost::ignore_unused_variable_warning( aUpperBound );
+    }
+
+    /// Removes all candidates.
+    void clear()
+    {
+      myBuckets.clear();
+      myBestValues.clear();
+      myFirstKey = 0;
+    }
+
+    /// @return 'true' if there is no candidate.
+    bool empty() const
+    {
+      return myBestValues.empty();
+    }
+
+    /// @return the number of candidate points.
+    std::size_t size() const
+    {
+      return myBestValues.size();
+    }
+
+    /**
+     * Inserts a candidate in the bucket of its absolute value (or in
+     * the first bucket if it is lower).
+     * @param aPair a pair (point, tentative value).
+     */
+    void push( const PointValue & aPair );
+
+    /// @return the next candidate (in the first non-empty bucket).
+    const PointValue & top() const
+    {
+      ASSERT( ! empty() );
+      return myBuckets.front().front();
+    }
+
+    /// Removes the next candidate.
+    void pop();
+
+  private:
+    /**
+     * Removes the superseded entries and the empty buckets at the
+     * front of the queue, so that the first entry of the first bucket
+     * is the next candidate.
+     */
+    void skipSuperseded();
+
+    /// @return 'true' if @a aPair is the best entry of its point.
+    bool isBest( const PointValue & aPair ) const
+    {
+      auto found = myBestValues.find( aPair.first );
+      return ( found != myBestValues.end() ) && ( found->second == aPair.second );
+    }
+
+  private:
+    /// Bucket type.
+    typedef std::deque<PointValue> Bucket;
+
+    /// Bucket width.
+    double myBucketWidth;
+    /// Buckets (the first one is the one of key myFirstKey).
+    std::deque<Bucket> myBuckets;
+    /// Best tentative value of each candidate point.
+    std::unordered_map<Point, Value> myBestValues;
+    /// Key of the first bucket.
+    DGtal::int64_t myFirstKey;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FMMCandidateQueues.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FMMCandidateQueues_h
+
+#undef FMMCandidateQueues_RECURSES
+#endif // else defined(FMMCandidateQueues_RECURSES)
@@ -254,6 +254,8 @@ namespace DGtal
     Image* myImgPtr; 
     /// Aliasing pointer on the underlying set
     Set* mySetPtr; 
+    /// 'true' if the neighbors that are not upwind are ignored
+    bool myUpwindOnly; 
 
 
     // ----------------------- Interface --------------------------------------
@@ -299,6 +301,17 @@ namespace DGtal
      */
     Value operator() (const Point& aPoint);
 
+    /**
+     * Sets whether the neighbors that are not upwind, i.e. whose
+     * values are greater (in absolute value) than the computed value,
+     * are ignored ('false' by default). FMM does not need it, since
+     * it only reads accepted points, but FIM does, since it reads
+     * values that have not converged yet (see FIM).
+     *
+     * @param aFlag 'true' to ignore the neighbors that are not upwind.
+     */
+    void setUpwindOnly(bool aFlag); 
+
     /**
      * Writes/Displays the object on an output stream.
      * @param out the output stream where the object is written.
@@ -381,6 +394,8 @@ namespace DGtal
     Image* myImgPtr; 
     /// Aliasing pointer on the underlying set
     Set* mySetPtr; 
+    /// 'true' if the neighbors that are not upwind are ignored
+    bool myUpwindOnly; 
 
 
     // ----------------------- Interface --------------------------------------
@@ -427,6 +442,17 @@ namespace DGtal
      */
     Value operator() (const Point& aPoint);
 
+    /**
+     * Sets whether the neighbors that are not upwind, i.e. whose
+     * values are greater (in absolute value) than the computed value,
+     * are ignored ('false' by default). FMM does not need it, since
+     * it only reads accepted points, but FIM does, since it reads
+     * values that have not converged yet (see FIM).
+     *
+     * @param aFlag 'true' to ignore the neighbors that are not upwind.
+     */
+    void setUpwindOnly(bool aFlag); 
+
     /**
      * Writes/Displays the object on an output stream.
      * @param out the output stream where the object is written.
@@ -46,6 +46,7 @@
 #include <iostream>
 #include <vector>
 #include <array>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
@@ -53,6 +54,7 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -60,6 +62,359 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class VoronoiMapTileAccessor
+  /**
+   * Description of template class 'VoronoiMapTileAccessor' <p>
+   * \brief Aim: Small helper used by the cache-blocked pass of
+   * VoronoiMap to gather (resp. scatter) a tile of lines from (resp.
+   * to) an image into an interleaved buffer.
+   *
+   * A tile is made of @a width lines along dimension @a dim, the
+   * l-th line starting at @a start + l.e_0. The value at position i
+   * along @a dim of the l-th line is stored at buffer[ i * width + l ].
+   *
+   * This generic version uses the image operator() and setValue
+   * methods. It is specialized for ImageContainerBySTLVector in order
+   * to access the underlying memory directly.
+   *
+   * @tparam TImage a model of concepts::CImage.
+   */
+    template < typename TImage >
+    struct VoronoiMapTileAccessor
+    {
+      typedef typename TImage::Point Point;
+      typedef typename TImage::Value Value;
+      typedef typename TImage::Domain::Dimension Dimension;
+
+      /**
+       * Gathers a tile into a buffer.
+       *
+       * @param [in] image the image.
+       * @param [in] start the starting point of the first line.
+       * @param [in] dim the dimension of the lines.
+       * @param [in] extent the number of points per line.
+       * @param [in] width the number of lines.
+       * @param [out] buffer a buffer of size @a extent * @a width.
+       */
+      static void gather( const TImage & image, Point start, const Dimension dim,
+                          const std::size_t extent, const std::size_t width,
+                          Value * buffer )
+      {
+        const auto x0 = start[0];
+        for ( std::size_t i = 0; i < extent; ++i, ++start[dim] )
+          {
+            start[0] = x0;
+            for ( std::size_t l = 0; l < width; ++l, ++start[0] )
+              *buffer++ = image( start );
+          }
+      }
+
+      /**
+       * Scatters a buffer into a tile.
+       *
+       * @param [in,out] image the image.
+       * @param [in] start the starting point of the first line.
+       * @param [in] dim the dimension of the lines.
+       * @param [in] extent the number of points per line.
+       * @param [in] width the number of lines.
+       * @param [in] buffer a buffer of size @a extent * @a width.
+       */
+      static void scatter( TImage & image, Point start, const Dimension dim,
+                           const std::size_t extent, const std::size_t width,
+                           const Value * buffer )
+      {
+        const auto x0 = start[0];
+        for ( std::size_t i = 0; i < extent; ++i, ++start[dim] )
+          {
+            start[0] = x0;
+            for ( std::size_t l = 0; l < width; ++l, ++start[0] )
+              image.setValue( start, *buffer++ );
+          }
+      }
+    };
+
+    /**
+     * Specialization of VoronoiMapTileAccessor for
+     * ImageContainerBySTLVector: rows of the tile are contiguous
+     * memory blocks of the underlying vector.
+     *
+     * @tparam TDomain the image domain type.
+     * @tparam TValue the image value type.
+     */
+    template < typename TDomain, typename TValue >
+    struct VoronoiMapTileAccessor< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+      typedef typename Image::Point Point;
+      typedef typename Image::Value Value;
+      typedef typename TDomain::Dimension Dimension;
+
+      /// @return the offset between two consecutive points along @a dim.
+      static std::size_t stride( const Image & image, const Dimension dim )
+      {
+        std::size_t s = 1;
+        for ( Dimension k = 0; k < dim; ++k )
+          s *= image.domain().upperBound()[k] - image.domain().lowerBound()[k] + 1;
+        return s;
+      }
+
+      /// Gathers a tile into a buffer (see generic version).
+      static void gather( const Image & image, const Point & start, const Dimension dim,
+                          const std::size_t extent, const std::size_t width,
+                          Value * buffer )
+      {
+        const std::size_t s = stride( image, dim );
+        const Value * row = image.data() + image.linearized( start );
+        for ( std::size_t i = 0; i < extent; ++i, row += s, buffer += width )
+          std::copy( row, row + width, buffer );
+      }
+
+      /// Scatters a buffer into a tile (see generic version).
+      static void scatter( Image & image, const Point & start, const Dimension dim,
+                           const std::size_t extent, const std::size_t width,
+                           const Value * buffer )
+      {
+        const std::size_t s = stride( image, dim );
+        Value * row = image.data() + image.linearized( start );
+        for ( std::size_t i = 0; i < extent; ++i, row += s, buffer += width )
+          std::copy( buffer, buffer + width, row );
+      }
+    };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class VoronoiMapTileLanes
+  /**
+   * Description of template class 'VoronoiMapTileLanes' <p>
+   * \brief Aim: Small helper used by the cache-blocked pass of
+   * VoronoiMap to prune and rewrite the sites of the lanes of a tile
+   * gathered by VoronoiMapTileAccessor.
+   *
+   * This generic version calls the hiddenBy and closest predicates of
+   * the metric on the sites. It is specialized for the @f$ l_2@f$
+   * ExactPredicateLpSeparableMetric.
+   *
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric.
+   */
+    template < typename TSeparableMetric >
+    struct VoronoiMapTileLanes
+    {
+      /**
+       * Prunes then rewrites the sites of the lanes of a tile.
+       *
+       * @param [in] metric the separable metric.
+       * @param [in,out] tile the tile (site at position i along @a dim
+       * of lane l stored at tile[ i * width + l ]).
+       * @param [in] infinity the value of the points without site.
+       * @param [in] startingPoint the first point of the first lane,
+       * the l-th lane starting at @a startingPoint + l.e_0.
+       * @param [in] upper the last coordinate of the lanes along @a dim.
+       * @param [in] dim the dimension of the lanes.
+       * @param [in] extent the number of points per lane.
+       * @param [in] width the number of lanes.
+       * @param [in,out] buffers scratch buffers (see VoronoiMap::TileBuffers).
+       * @return the rewritten tile (@a tile itself, or a buffer of
+       * @a buffers), with the same layout.
+       */
+      template < typename Point, typename Dimension, typename Buffers >
+      static const Point * process( const TSeparableMetric & metric, Point * tile, const Point & infinity,
+                                    const Point & startingPoint, const typename Point::Coordinate upper,
+                                    const Dimension dim, const std::size_t extent, const std::size_t width,
+                                    Buffers & buffers )
+      {
+        typedef typename Point::Coordinate Abscissa;
+
+        // Starting and ending point of each lane.
+        std::vector<Point> & startPoints = buffers.startPoints;
+        std::vector<Point> & endPoints   = buffers.endPoints;
+        startPoints.assign( width, startingPoint );
+        endPoints.assign( width, startingPoint );
+        for ( std::size_t l = 0; l < width; ++l )
+          {
+            startPoints[l][0] += static_cast<Abscissa>( l );
+            endPoints[l][0]   += static_cast<Abscissa>( l );
+            endPoints[l][dim]  = upper;
+          }
+
+        // Site stacks: lane l uses sites[ l * extent .. (l+1) * extent - 1 ].
+        std::vector<Point> & sites = buffers.sites;
+        std::vector<std::size_t> & nbSites = buffers.nbSites;
+        sites.resize( extent * width );
+        nbSites.assign( width, 0 );
+
+        // Pruning the list of sites of each lane (for dim = 0, no
+        // sites are hidden).
+        for ( std::size_t i = 0; i < extent; ++i )
+          for ( std::size_t l = 0; l < width; ++l )
+            {
+              const Point & psite = tile[ i * width + l ];
+              if ( psite != infinity )
+                {
+                  Point * laneSites = &sites[ l * extent ];
+                  std::size_t & nb  = nbSites[ l ];
+                  while (( dim > 0 ) && ( nb >= 2 ) &&
+                         ( metric.hiddenBy( laneSites[nb-2], laneSites[nb-1],
+                                            psite, startPoints[l], endPoints[l], dim) ))
+                    --nb;
+
+                  laneSites[ nb++ ] = psite;
+                }
+            }
+
+        // Rewriting the tile.
+        std::vector<std::size_t> & siteIds = buffers.siteIds;
+        std::vector<Point> & points = buffers.points;
+        siteIds.assign( width, 0 );
+        points.assign( startPoints.begin(), startPoints.end() );
+        for ( std::size_t i = 0; i < extent; ++i )
+          for ( std::size_t l = 0; l < width; ++l )
+            {
+              const std::size_t nb = nbSites[ l ];
+              if ( nb == 0 )
+                continue;
+
+              const Point * laneSites = &sites[ l * extent ];
+              std::size_t & siteId    = siteIds[ l ];
+              points[l][dim] = startingPoint[dim] + static_cast<Abscissa>( i );
+              while ( ( siteId < nb-1 ) &&
+                      ( metric.closest( points[l], laneSites[siteId], laneSites[siteId+1])
+                        != DGtal::ClosestFIRST ))
+                siteId++;
+
+              tile[ i * width + l ] = laneSites[ siteId ];
+            }
+        return tile;
+      }
+    };
+
+    /**
+     * Specialization of VoronoiMapTileLanes for the @f$ l_2@f$
+     * ExactPredicateLpSeparableMetric.
+     *
+     * All the points of a lane share their coordinates but along the
+     * lane dimension, hence the squared distance from a site to any
+     * point of the lane is the sum of a term along the lane and of a
+     * constant height (the squared distance from the site to the lane
+     * line). The heights of the sites of the tile are computed once,
+     * in a branch-free loop, then each lane is processed with a stack
+     * of abscissas and heights: the hiddenBy and closest predicates
+     * are evaluated with the same integer expressions as
+     * ExactPredicateLpSeparableMetric, without going through the
+     * points, and the sites are only copied to the rewritten tile.
+     * The output is identical.
+     *
+     * @tparam TSpace the space of the metric.
+     * @tparam TRawValue the raw value type of the metric.
+     */
+    template < typename TSpace, typename TRawValue >
+    struct VoronoiMapTileLanes< ExactPredicateLpSeparableMetric<TSpace, 2, TRawValue> >
+    {
+      typedef ExactPredicateLpSeparableMetric<TSpace, 2, TRawValue> Metric;
+
+      /// Prunes then rewrites the sites of the lanes of a tile (see generic version).
+      template < typename Point, typename Dimension, typename Buffers >
+      static const Point * process( const Metric & /*metric*/, const Point * tile, const Point & infinity,
+                                    const Point & startingPoint, const typename Point::Coordinate /*upper*/,
+                                    const Dimension dim, const std::size_t extent, const std::size_t width,
+                                    Buffers & buffers )
+      {
+        typedef typename Point::Coordinate Abscissa;
+        typedef TRawValue RawValue;
+        const std::size_t size = extent * width;
+
+        // Heights of the sites of the tile, -1 for the points without
+        // site. The site of a point has the same coordinates as the
+        // point along dimensions dim and above.
+        std::vector<RawValue> & heights = buffers.heights;
+        heights.resize( size );
+        for ( std::size_t i = 0; i < extent; ++i )
+          for ( std::size_t l = 0; l < width; ++l )
+            {
+              const Point & psite = tile[ i * width + l ];
+              bool site = false;
+              for ( Dimension j = 0; j < Point::dimension; ++j )
+                site |= ( psite[j] != infinity[j] );
+              RawValue h = 0;
+              for ( Dimension j = 0; j < dim; ++j )
+                {
+                  const Abscissa x = startingPoint[j] + ( j == 0 ? static_cast<Abscissa>( l ) : 0 );
+                  const RawValue d = static_cast<RawValue>( ( site ? psite[j] : x ) - x );
+                  h += d * d;
+                }
+              h = site ? h : -1;
+              heights[ i * width + l ] = h;
+            }
+
+        // Site stack of the current lane: abscissas relative to the
+        // lane start (i.e. rows of the tile) and heights.
+        std::vector<Abscissa> & stackAbscissas = buffers.stackAbscissas;
+        std::vector<RawValue> & stackHeights = buffers.stackHeights;
+        stackAbscissas.resize( extent );
+        stackHeights.resize( extent );
+        Abscissa * abscissas = stackAbscissas.data();
+        RawValue * stacked   = stackHeights.data();
+
+        // The rewritten tile.
+        std::vector<Point> & output = buffers.sites;
+        output.resize( size );
+        Point * out = output.data();
+
+        for ( std::size_t l = 0; l < width; ++l )
+          {
+            // Pruning the list of sites: w hides v if
+            // (c.h_v - b.h_u - a.h_w - a.b.c) > 0 (see
+            // ExactPredicateLpSeparableMetric::hiddenBy).
+            std::size_t nb = 0;
+            for ( std::size_t i = 0; i < extent; ++i )
+              {
+                const RawValue hw = heights[ i * width + l ];
+                if ( hw < 0 )
+                  continue;
+
+                const Abscissa uw = static_cast<Abscissa>( i );
+                while ( nb >= 2 )
+                  {
+                    const RawValue a = abscissas[nb-1] - abscissas[nb-2];
+                    const RawValue b = uw - abscissas[nb-1];
+                    const RawValue c = a + b;
+                    if ( c * stacked[nb-1] - b * stacked[nb-2] - a * hw - a * b * c <= 0 )
+                      break;
+                    --nb;
+                  }
+                abscissas[ nb ] = uw;
+                stacked[ nb ]   = hw;
+                ++nb;
+              }
+
+            if ( nb == 0 )
+              {
+                for ( std::size_t i = 0; i < extent; ++i )
+                  out[ i * width + l ] = infinity;
+                continue;
+              }
+
+            std::size_t siteId = 0;
+            for ( std::size_t i = 0; i < extent; ++i )
+              {
+                const Abscissa x = static_cast<Abscissa>( i );
+                while ( siteId < nb-1 )
+                  {
+                    const RawValue d1 = static_cast<RawValue>( x - abscissas[siteId] );
+                    const RawValue d2 = static_cast<RawValue>( x - abscissas[siteId+1] );
+                    if ( d1 * d1 + stacked[siteId] < d2 * d2 + stacked[siteId+1] )
+                      break;
+                    siteId++;
+                  }
+                out[ i * width + l ] = tile[ abscissas[siteId] * width + l ];
+              }
+          }
+        return out;
+      }
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class VoronoiMap
   /**
@@ -102,6 +457,21 @@ namespace DGtal
    * in an optimal way: on @a p processors, expected runtime is in
    * @f$ O(h.d.n^d / p)@f$.
    *
+   * Along non-periodic dimensions other than the first one, the 1D
+   * problems are solved by tiles of TileWidth lines that are adjacent
+   * along the first dimension (cache-blocked pass). Each tile is
+   * gathered into a contiguous buffer (consecutive lines being
+   * interleaved so that memory accesses to the image are contiguous),
+   * the site pruning and rewriting steps are performed lane by lane
+   * on this buffer, and the result is scattered back into the
+   * image. Along a non-periodic first dimension, the lines are
+   * processed the same way, one at a time, the sites being read from
+   * the predicate (the image is not initialized beforehand). For the
+   * @f$ l_2@f$ ExactPredicateLpSeparableMetric, the predicates are
+   * evaluated on the abscissas and squared heights of the sites (see
+   * detail::VoronoiMapTileLanes). The output is identical to the
+   * line-by-line process.
+   *
    * This class is a model of concepts::CConstImage.
    *
    * @see &nbsp; \ref toricVol
@@ -186,6 +556,10 @@ namespace DGtal
     /// Periodicity specification type.
     typedef std::array< bool, Space::dimension > PeriodicitySpec;
 
+    /// Number of lines (along the first dimension) processed together
+    /// by the cache-blocked pass.
+    static const Size TileWidth = 16;
+
     /**
      * Constructor in the non-periodic case.
      *
@@ -363,6 +737,44 @@ namespace DGtal
     void computeOtherStep1D (const Point &row,
                              const Dimension dim) const;
 
+    /// Scratch buffers of the cache-blocked pass. They are allocated
+    /// by the first tile and only reused afterwards.
+    struct TileBuffers
+    {
+      std::vector<Point> tile;        ///< Interleaved values of the tile.
+      std::vector<Point> sites;       ///< Site stacks of the lanes (rewritten tile for l_2).
+      std::vector<std::size_t> nbSites; ///< Stack sizes.
+      std::vector<std::size_t> siteIds; ///< Current site of each lane.
+      std::vector<Point> startPoints; ///< First point of each lane.
+      std::vector<Point> endPoints;   ///< Last point of each lane.
+      std::vector<Point> points;      ///< Current point of each lane.
+      std::vector<typename SeparableMetric::RawValue> heights;      ///< Site heights (l_2 lanes).
+      std::vector<Abscissa> stackAbscissas;                         ///< Stacked rows (l_2 lanes).
+      std::vector<typename SeparableMetric::RawValue> stackHeights; ///< Stacked heights (l_2 lanes).
+    };
+
+    /**
+     * Cache-blocked version of computeOtherStep1D: given a voronoi map
+     * valid at dimension @a dim-1, this method updates the map to make
+     * it consistent at dimension @a dim along the (at most) TileWidth
+     * 1D spans starting at @a row, @a row + e_0, @a row + 2.e_0, ...
+     * For @a dim = 0, the tile is the single 1D span starting at @a
+     * row and its sites are read from the predicate.
+     *
+     * The tile is gathered into an interleaved buffer (lane index
+     * varying first), processed lane by lane, and scattered back.
+     *
+     * @pre @a dim is not a periodic dimension.
+     *
+     * @param [in] row starting point of the first 1D span of the tile.
+     * @param [in] dim dimension of the update.
+     * @param [in,out] buffers scratch buffers, reused from one tile
+     * to the next (one instance per thread).
+     */
+    void computeOtherStepTile (const Point &row,
+                               const Dimension dim,
+                               TileBuffers & buffers) const;
+
     /**
      * Project a coordinate into the domain, taking into account
      * the periodicity.
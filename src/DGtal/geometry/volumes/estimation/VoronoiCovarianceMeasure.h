@@ -42,6 +42,8 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <vector>
+#include <map>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -64,8 +66,22 @@ namespace DGtal
    * of a set of points. It can compute the covariance measure of an
    * arbitrary function with given support.
    *
-   * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * The Voronoi covariance matrices of the cells are stored in a flat
+   * array aligned with the sorted sequence of points of K (see \ref
+   * vcmPoints and \ref vcmMatrices), a point being associated with
+   * its index during computations by an image of the domain. You may
+   * also obtain the whole sequence (Point,VCM) as a map with \ref
+   * vcmMap.
+   *
+   * With OpenMP, the accumulation of the covariance matrices of the
+   * Voronoi cells is parallel, by slabs of the domain along its last
+   * axis: since a point contributes to a cell only if it is at a
+   * distance at most R of its site, slabs of thickness 2R of the same
+   * parity never contribute to the same cell and are processed
+   * simultaneously. As the contributions are products of integers,
+   * the matrices do not depend on the number of threads. The
+   * measure of a kernel function at a range of points is also
+   * computed in parallel (see \ref measure).
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -89,6 +105,7 @@ namespace DGtal
     typedef typename Space::Integer Integer;      ///< the type of each digital point coordinate, some integral type
     typedef DGtal::HyperRectDomain<Space> Domain; ///< the type of rectangular domain of the VCM.
     typedef DGtal::ImageContainerBySTLVector<Domain,bool> CharacteristicSet; ///< the type of a binary image that is the characteristic function of K.
+    typedef DGtal::ImageContainerBySTLVector<Domain,Size> IndexImage; ///< the type of an image giving 1 + the index of each point of K (0 elsewhere).
     typedef DGtal::SpatialCubicalSubdivision<Space> ProximityStructure; ///< the structure used for proximity queries.
 
     /**
@@ -120,6 +137,7 @@ namespace DGtal
                                  Space::dimension > MatrixNN; ///< the type for nxn matrix of real numbers.
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
+    typedef std::vector<MatrixNN> MatrixContainer;            ///< the list of matrices
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
 
     // ----------------------- Standard services ------------------------------
@@ -155,8 +173,8 @@ namespace DGtal
     Scalar r() const;
  
     /**
-       Cleans intermediate data structure likes the characteristic set and the voronoi map.
-       @note Further calls to voronoiMap are no more valid.
+       Cleans intermediate data structure likes the characteristic set, the index image and the voronoi map.
+       @note Further calls to voronoiMap and measure are no more valid.
     */
     void clean();
 
@@ -179,10 +197,19 @@ namespace DGtal
     /// @pre init must have been called before.
     const Voronoi& voronoiMap() const;
 
+    /// @return the points of K, sorted and without duplicates.
+    /// @note empty if \ref init has not been called.
+    const PointContainer& vcmPoints() const;
+
+    /// @return the Voronoi Covariance Matrix of each Voronoi cell, in
+    /// the order of \ref vcmPoints.
+    /// @note empty if \ref init has not been called.
+    const MatrixContainer& vcmMatrices() const;
+
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
-    /// a map Point -> Matrix
+    /// a map Point -> Matrix, built from \ref vcmPoints and \ref vcmMatrices.
     /// @note empty if \ref init has not been called.
-    const Point2MatrixNN& vcmMap() const;
+    Point2MatrixNN vcmMap() const;
 
     /**
     Computes the Voronoi Covariance Measure of the function \a chi_r.
@@ -200,6 +227,26 @@ namespace DGtal
     template <typename Point2ScalarFunction>
     MatrixNN measure( Point2ScalarFunction chi_r, Point p ) const;
 
+    /**
+    Computes the Voronoi Covariance Measure of the function \a chi_r
+    at each point of the range [itb,ite), in parallel with OpenMP.
+
+    @tparam Point2ScalarFunction the type of a functor Point->Scalar
+    (copied for each thread).
+    @tparam PointInputIterator an input iterator on digital points.
+    @tparam MatrixOutputIterator an output iterator on MatrixNN.
+
+    @param chi_r the kernel function (see \ref measure).
+    @param itb the start of the range of points, which must lie within domain.
+    @param ite the end of the range of points.
+    @param out the output iterator where the measures are written, in the order of the range.
+    @return the output iterator after the last measure.
+    */
+    template <typename Point2ScalarFunction, typename PointInputIterator, typename MatrixOutputIterator>
+    MatrixOutputIterator measure( Point2ScalarFunction chi_r,
+                                  PointInputIterator itb, PointInputIterator ite,
+                                  MatrixOutputIterator out ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -233,10 +280,14 @@ namespace DGtal
     Domain myDomain;
     /// A binary image that defines the characteristic set of K.
     CharacteristicSet* myCharSet;
+    /// An image giving 1 + the index in myPoints of each point of K (0 elsewhere).
+    IndexImage* myIndices;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
-    Point2MatrixNN myVCM;
+    /// The points of K, sorted and without duplicates.
+    PointContainer myPoints;
+    /// The VCM of the Voronoi cell of each point of myPoints.
+    MatrixContainer myMatrices;
     /// The structure used for proximity queries.
     ProximityStructure* myProximityStructure;
 
@@ -0,0 +1,422 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseVertexContainers.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for template classes DenseVertexSet and DenseVertexMap
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseVertexContainers_RECURSES)
+#error Recursive header files inclusion detected in DenseVertexContainers.h
+#else // defined(DenseVertexContainers_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseVertexContainers_RECURSES
+
+#if !defined DenseVertexContainers_h
+/** Prevents repeated inclusion of headers. */
+#define DenseVertexContainers_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseVertexSet
+  /**
+     Description of template class 'DenseVertexSet' <p> \brief Aim: A
+     set of vertices of a graph whose vertices are the indices 0, 1,
+     ..., n-1 (like IndexedDigitalSurface), stored as one bit per
+     vertex in 64-bit words.
+
+     It has the interface of std::set used by graph visitors (insert,
+     find, erase, count, iteration) and iterates over the vertices by
+     increasing index. The words grow with the greatest inserted
+     vertex, so that a set of n vertices uses n/8 bytes instead of
+     about 40 bytes per vertex in a std::set.
+
+     @tparam TVertex the type of vertices, an unsigned integer type.
+  */
+  template <typename TVertex>
+  class DenseVertexSet
+  {
+  public:
+    typedef DenseVertexSet<TVertex> Self;
+    typedef TVertex                 Vertex;
+    typedef TVertex                 key_type;
+    typedef TVertex                 value_type;
+    typedef std::size_t             size_type;
+    typedef DGtal::uint64_t         Word;
+
+    /// Forward iterator visiting the vertices by increasing index.
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef TVertex                   value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef const TVertex*            pointer;
+      typedef const TVertex&            reference;
+
+      ConstIterator() : mySet( 0 ), myVertex( 0 ) {}
+      ConstIterator( const DenseVertexSet* aSet, Vertex v )
+        : mySet( aSet ), myVertex( v ) {}
+      reference operator*() const  { return myVertex; }
+      pointer   operator->() const { return &myVertex; }
+      ConstIterator& operator++()
+      {
+        myVertex = mySet->nextVertex( myVertex + 1 );
+        return *this;
+      }
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+      bool operator==( const ConstIterator& other ) const
+      { return myVertex == other.myVertex; }
+      bool operator!=( const ConstIterator& other ) const
+      { return myVertex != other.myVertex; }
+    private:
+      const DenseVertexSet* mySet;
+      Vertex myVertex;
+    };
+    typedef ConstIterator iterator;
+    typedef ConstIterator const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /**
+     * Constructor. The empty set.
+     * @param n the number of vertices that may be inserted without growing.
+     */
+    DenseVertexSet( size_type n = 0 );
+
+    /// @return an iterator on the first vertex of the set.
+    ConstIterator begin() const;
+    /// @return an iterator after the last vertex of the set.
+    ConstIterator end() const;
+
+    /// @return 'true' iff the set is empty.
+    bool empty() const;
+    /// @return the number of vertices in the set.
+    size_type size() const;
+    /// @return the number of vertices that may be inserted without growing.
+    size_type capacity() const;
+    /// Lets the vertices 0 to \a n-1 be inserted without growing.
+    /// @param n any number of vertices.
+    void reserve( size_type n );
+    /// Removes all the vertices.
+    void clear();
+
+    /**
+     * Inserts a vertex.
+     * @param v any vertex.
+     * @return an iterator on \a v and 'true' iff \a v was not in the set.
+     */
+    std::pair<ConstIterator, bool> insert( Vertex v );
+
+    /**
+     * Inserts a range of vertices.
+     * @tparam InputIterator a model of input iterator on vertices.
+     * @param first the first vertex of the range.
+     * @param last after the last vertex of the range.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator first, InputIterator last );
+
+    /// @param v any vertex.
+    /// @return the number of erased vertices (0 or 1).
+    size_type erase( Vertex v );
+    /// @param it an iterator on a vertex of the set.
+    /// @return an iterator on the next vertex.
+    ConstIterator erase( ConstIterator it );
+
+    /// @param v any vertex.
+    /// @return an iterator on \a v if it is in the set, end() otherwise.
+    ConstIterator find( Vertex v ) const;
+    /// @param v any vertex.
+    /// @return 1 if \a v is in the set, 0 otherwise.
+    size_type count( Vertex v ) const;
+
+    /// @param other any other set.
+    /// @return 'true' iff both sets have the same vertices.
+    bool operator==( const DenseVertexSet& other ) const;
+    /// @param other any other set.
+    /// @return 'true' iff the sets have not the same vertices.
+    bool operator!=( const DenseVertexSet& other ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+    /// @return the end vertex, greater than any vertex of the set.
+    Vertex endVertex() const;
+    /// @param v any vertex.
+    /// @return the first vertex of the set greater or equal to \a v, or endVertex().
+    Vertex nextVertex( Vertex v ) const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The bits of vertices, 64 vertices per word.
+    std::vector<Word> myWords;
+    /// The number of vertices in the set.
+    size_type mySize;
+
+  }; // end of class DenseVertexSet
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseVertexMap
+  /**
+     Description of template class 'DenseVertexMap' <p> \brief Aim: A
+     map from the vertices of a graph whose vertices are the indices
+     0, 1, ..., n-1 (like IndexedDigitalSurface) to values, stored as
+     a vector of pairs (vertex, value) indexed by vertices, together
+     with one bit per vertex telling if it has a value.
+
+     It has the interface of std::map used for vertex maps
+     (operator[], insert, find, erase, count, iteration by increasing
+     vertex), and is a model of concepts::CVertexMap (setValue,
+     operator()). As for std::map, iterators are forward iterators
+     on std::pair<const Vertex, Value>, so that \c it->first, \c
+     it->second and <tt>for ( auto & kv : map )</tt> are valid.
+
+     @tparam TVertex the type of vertices, an unsigned integer type.
+     @tparam TValue the type of values, default constructible and copyable.
+  */
+  template <typename TVertex, typename TValue>
+  class DenseVertexMap
+  {
+  public:
+    typedef DenseVertexMap<TVertex, TValue> Self;
+    typedef TVertex                         Vertex;
+    typedef TValue                          Value;
+    typedef TVertex                         key_type;
+    typedef TValue                          mapped_type;
+    typedef std::pair<const TVertex, TValue> value_type;
+    typedef std::size_t                     size_type;
+    typedef DenseVertexSet<TVertex>         VertexSet;
+
+    /// Forward iterator visiting the pairs (vertex, value) by increasing vertex.
+    template <bool IsConst>
+    class Iterator
+    {
+    public:
+      typedef typename std::conditional< IsConst, const Self*, Self* >::type MapPointer;
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename Self::value_type value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef typename std::conditional< IsConst, const value_type*, value_type* >::type pointer;
+      typedef typename std::conditional< IsConst, const value_type&, value_type& >::type reference;
+
+      Iterator() : myMap( 0 ) {}
+      Iterator( MapPointer aMap, typename VertexSet::ConstIterator it )
+        : myMap( aMap ), myIt( it ) {}
+      /// Conversion from a mutable iterator.
+      Iterator( const Iterator<false>& other )
+        : myMap( other.myMap ), myIt( other.myIt ) {}
+      reference operator*() const  { return myMap->myEntries[ *myIt ]; }
+      pointer   operator->() const { return &myMap->myEntries[ *myIt ]; }
+      Iterator& operator++() { ++myIt; return *this; }
+      Iterator operator++( int )
+      {
+        Iterator tmp( *this );
+        ++myIt;
+        return tmp;
+      }
+      bool operator==( const Iterator& other ) const { return myIt == other.myIt; }
+      bool operator!=( const Iterator& other ) const { return myIt != other.myIt; }
+    private:
+      MapPointer myMap;
+      typename VertexSet::ConstIterator myIt;
+      friend class DenseVertexMap;
+      friend class Iterator<true>;
+    };
+    typedef Iterator<false> iterator;
+    typedef Iterator<true>  const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /**
+     * Constructor. The empty map.
+     * @param n the number of vertices that may be inserted without growing.
+     */
+    DenseVertexMap( size_type n = 0 );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DenseVertexMap( const DenseVertexMap& other ) = default;
+
+    /**
+     * Assignment (the pairs have a const vertex, so that they are
+     * copied and not assigned).
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DenseVertexMap& operator=( const DenseVertexMap& other );
+
+    /// @return an iterator on the first pair of the map.
+    iterator begin();
+    /// @return an iterator after the last pair of the map.
+    iterator end();
+    /// @return an iterator on the first pair of the map.
+    const_iterator begin() const;
+    /// @return an iterator after the last pair of the map.
+    const_iterator end() const;
+
+    /// @return 'true' iff the map is empty.
+    bool empty() const;
+    /// @return the number of vertices with a value.
+    size_type size() const;
+    /// Lets the vertices 0 to \a n-1 be inserted without growing.
+    /// @param n any number of vertices.
+    void reserve( size_type n );
+    /// Removes all the values.
+    void clear();
+    /// @return the set of vertices with a value.
+    const VertexSet& vertices() const;
+
+    /**
+     * @param v any vertex.
+     * @return a reference to the value of \a v, inserting a default
+     * value if \a v has none.
+     */
+    Value& operator[]( Vertex v );
+
+    /**
+     * Inserts a pair (vertex, value) if the vertex has no value.
+     * @param aPair any pair (vertex, value).
+     * @return an iterator on the value of the vertex and 'true' iff it was inserted.
+     */
+    std::pair<iterator, bool> insert( const std::pair<Vertex, Value>& aPair );
+
+    /// @param v any vertex.
+    /// @return the number of erased values (0 or 1).
+    size_type erase( Vertex v );
+    /// @param v any vertex.
+    /// @return an iterator on the value of \a v if it has one, end() otherwise.
+    iterator find( Vertex v );
+    /// @param v any vertex.
+    /// @return an iterator on the value of \a v if it has one, end() otherwise.
+    const_iterator find( Vertex v ) const;
+    /// @param v any vertex.
+    /// @return 1 if \a v has a value, 0 otherwise.
+    size_type count( Vertex v ) const;
+
+    /// @param v any vertex with a value.
+    /// @return the value of \a v.
+    const Value& at( Vertex v ) const;
+
+    /// Sets the value of a vertex (model of concepts::CVertexMap).
+    /// @param v any vertex.
+    /// @param aValue any value.
+    void setValue( Vertex v, const Value& aValue );
+
+    /// @param v any vertex with a value.
+    /// @return the value of \a v (model of concepts::CVertexMap).
+    Value operator()( Vertex v ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+    /// Adds the pairs (vertex, default value) of the vertices
+    /// myEntries.size() to myVertices.capacity()-1.
+    void grow();
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The vertices with a value.
+    VertexSet myVertices;
+    /// The pairs (v, value) indexed by vertices v (values are only
+    /// meaningful for vertices in myVertices, and are default otherwise).
+    std::vector<value_type> myEntries;
+
+  }; // end of class DenseVertexMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseVertexSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseVertexSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TVertex>
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseVertexSet<TVertex> & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseVertexMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseVertexMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TVertex, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseVertexMap<TVertex, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/DenseVertexContainers.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseVertexContainers_h
+
+#undef DenseVertexContainers_RECURSES
+#endif // else defined(DenseVertexContainers_RECURSES)
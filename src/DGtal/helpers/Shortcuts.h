@@ -1158,25 +1158,24 @@ namespace DGtal
           }	
         bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
         SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
-        // Extracts all boundary surfels
-        SurfelSet all_surfels;
-        Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                         K.lowerBound(), K.upperBound() );
-        // Builds all connected components of surfels.
-        SurfelSet marked_surfels;
-        CountedPtr<LightDigitalSurface> ptrSurface;
-        for ( auto bel : all_surfels )
+        // Labels all boundary surfels with their connected component.
+        SurfelRange all_surfels;
+        std::vector<std::size_t> labels, sizes;
+        const std::size_t nb = Surfaces<KSpace>::labelAllConnectedSCell
+          ( all_surfels, labels, sizes, K, surfAdj, *bimage );
+        // Builds each component from its smallest surfel.
+        std::size_t c = 0;
+        for ( std::size_t i = 0; c < nb && i < all_surfels.size(); ++i )
           {
-            if ( marked_surfels.count( bel ) != 0 ) continue;
+            if ( labels[ i ] != c ) continue;
+            const SCell bel = all_surfels[ i ];
             surfel_reps.push_back( bel );
             LightSurfaceContainer* surfContainer
               = new LightSurfaceContainer( K, *bimage, surfAdj, bel );
-            ptrSurface = CountedPtr<LightDigitalSurface>
-              ( new LightDigitalSurface( surfContainer ) ); // acquired
-            // mark all surfels of the surface component.
-            marked_surfels.insert( ptrSurface->begin(), ptrSurface->end() );
             // add surface component to result.
-            result.push_back( ptrSurface );
+            result.push_back( CountedPtr<LightDigitalSurface>
+                              ( new LightDigitalSurface( surfContainer ) ) ); // acquired
+            ++c;
           }
         return result;
       }
@@ -1211,8 +1210,8 @@ namespace DGtal
           bool      surfel_adjacency = params[ "surfelAdjacency" ].as<int>();
           SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
           // Extracts all boundary surfels
-          Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                           K.lowerBound(), K.upperBound() );
+          Surfaces<KSpace>::sMakeBoundaryParallel( all_surfels, K, *bimage,
+                                                   K.lowerBound(), K.upperBound() );
           ExplicitSurfaceContainer* surfContainer
             = new ExplicitSurfaceContainer( K, surfAdj, all_surfels );
           return CountedPtr< DigitalSurface >
@@ -1282,8 +1281,8 @@ namespace DGtal
           }
         else if ( component == "All" )
           {
-            Surfaces<KSpace>::sMakeBoundary( surfels, K, *bimage,
-                                             K.lowerBound(), K.upperBound() );
+            Surfaces<KSpace>::sMakeBoundaryParallel( surfels, K, *bimage,
+                                                     K.lowerBound(), K.upperBound() );
           }
         return makeIdxDigitalSurface( surfels, K, params );
       }    
@@ -1313,7 +1312,7 @@ namespace DGtal
             ( new ExplicitSurfaceContainer( K, surfAdj, surfels ) );
           CountedPtr<IdxDigitalSurface> ptrSurface
             ( new IdxDigitalSurface() );
-          bool ok = ptrSurface->build( ptrSurfContainer );
+          bool ok = ptrSurface->build( ptrSurfContainer, true );
           if ( !ok )
             trace.warning() << "[Shortcuts::makeIdxDigitalSurface]"
                             << " Error building indexed digital surface." << std::endl;
@@ -641,6 +641,7 @@ namespace DGtal
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
+      ///   - IIconvolution   ["masks"]: the convolution backend of II estimators, either "masks" (incremental masks along the surfels) or "prefixSums" (prefix sums of the shape, independent of the order of surfels).
       static Parameters parametersGeometryEstimation()
       {
         return Parameters
@@ -650,7 +651,8 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
-          ( "surfelEmbedding",   0 );
+          ( "surfelEmbedding",   0 )
+          ( "IIconvolution", "masks" );
       }
 
       /// Given a digital space \a K and a vector of \a surfels,
@@ -834,6 +836,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -869,6 +872,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -910,6 +914,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -949,7 +954,7 @@ namespace DGtal
           functor.init( h, r*h );
           IINormalEstimator   ii_estimator( functor );
           ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
+          ii_estimator.setParams( r, params[ "IIconvolution" ].as<std::string>() == "prefixSums" );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( n_estimations ) );
@@ -971,6 +976,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1002,6 +1008,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1041,6 +1048,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1076,7 +1084,7 @@ namespace DGtal
           functor.init( h, r*h );
           IIMeanCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
+          ii_estimator.setParams( r, params[ "IIconvolution" ].as<std::string>() == "prefixSums" );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -1095,6 +1103,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1126,6 +1135,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1165,6 +1175,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1200,7 +1211,7 @@ namespace DGtal
           functor.init( h, r*h );
           IIGaussianCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
+          ii_estimator.setParams( r, params[ "IIconvolution" ].as<std::string>() == "prefixSums" );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -1220,6 +1231,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1252,6 +1264,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1291,6 +1304,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - IIconvolution   ["masks"]: the convolution backend, either "masks" or "prefixSums".
       ///
       /// @return the vector containing the estimated principal curvatures and directions,
       ///  in the same order as \a surfels.
@@ -1325,7 +1339,7 @@ namespace DGtal
         functor.init( h, r*h );
         IICurvEstimator ii_estimator( functor );
         ii_estimator.attach( K, shape );
-        ii_estimator.setParams( r );
+        ii_estimator.setParams( r, params[ "IIconvolution" ].as<std::string>() == "prefixSums" );
         ii_estimator.init( h, surfels.begin(), surfels.end() );
         ii_estimator.eval( surfels.begin(), surfels.end(),
                           std::back_inserter( mc_estimations ) );
@@ -80,7 +80,7 @@ Description of \b concept '\b CImageFactory' <p>
 # Invariants
 
 # Models
-ImageFactoryFromImage ImageFactoryFromHDF5
+ImageFactoryFromImage ImageFactoryFromHDF5 ImageFactoryAsync
 
 # Notes
 
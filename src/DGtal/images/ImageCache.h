@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <atomic>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -72,6 +74,14 @@ namespace DGtal
  *  - read :    for getting the value of an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - write :   for setting a   value on an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - update :  for updating the cache according to the read cache policy
+ *
+ * Several threads may read from the cache at the same time with
+ * concurrentRead, provided the read policy is sharded (see
+ * ImageCacheReadPolicyLRU): a read locks only the shard of the page
+ * it reads, a missing page being loaded (and the pages of the shard
+ * being detached) under this lock. The image factory must then
+ * accept concurrent requests of distinct domains, as
+ * ImageFactoryFromImage does.
  */
 template <typename TImageContainer, typename TImageFactory, typename TReadPolicy, typename TWritePolicy>
 class ImageCache
@@ -197,6 +207,22 @@ public:
      */
     void update(const Domain &aDomain);
     
+    /**
+     * Get the value of an image at a given position given by aPoint,
+     * from the page of domain aDomain, the page being loaded in the
+     * cache if needed. May be called concurrently by several threads,
+     * as long as no other method of the cache is called meanwhile.
+     *
+     * @pre the read policy provides shardMutex(aDomain) and
+     * getPageToDetach(aDomain) (e.g. ImageCacheReadPolicyLRU).
+     *
+     * @param aDomain the domain of a page (e.g. a tile).
+     * @param aPoint the point, inside aDomain.
+     *
+     * @return the value at aPoint.
+     */
+    Value concurrentRead(const Domain &aDomain, const Point & aPoint);
+    
     /**
      * Get the cacheMissRead value.
      */
@@ -260,8 +286,8 @@ protected:
 private:
     
     /// cache miss values
-    unsigned int cacheMissRead;
-    unsigned int cacheMissWrite;
+    std::atomic<unsigned int> cacheMissRead;
+    std::atomic<unsigned int> cacheMissWrite;
 
     // ------------------------- Internals ------------------------------------
 private:
@@ -41,6 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <deque>
+#include <list>
+#include <vector>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -130,7 +134,8 @@ public:
     
     /**
      * Get the alias on the image that we have to detach
-     * or NULL if no image have to be detached.
+     * or NULL if no image have to be detached. The image is
+     * removed from the cache.
      *
      * @return the alias on the image container or NULL pointer.
      */
@@ -266,6 +271,212 @@ protected:
     
 }; // end of class ImageCacheReadPolicyFIFO
 
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyLRU
+/**
+ * Description of template class 'ImageCacheReadPolicyLRU' <p>
+ * \brief Aim: implements a 'LRU' read policy cache bounded by a
+ * number of bytes.
+ * 
+ * The cache keeps the pages in memory in a list ordered by the time
+ * of their last access, the most recently used at the front. Each
+ * access to a page moves it at the front of the list, and when room
+ * is needed for a new page, the least recently used pages (at the
+ * back) are selected, until the new page fits in the memory budget.
+ * The memory of a page is estimated as the number of points of its
+ * domain times sizeof(Value), and the room needed for a new page as
+ * the size of the largest page ever loaded. The last loaded page is
+ * never selected, even if it alone exceeds the budget.
+ *
+ * The pages may be distributed over several shards, each shard
+ * having its own list, its own part of the budget and its own mutex,
+ * a page going to the shard given by a hash of the lower bound of
+ * its domain. Shards allow concurrent reads of an ImageCache (see
+ * ImageCache::concurrentRead) with one lock per shard instead of a
+ * single global lock.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 5 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains a point or NULL if no image in the cache contains that point
+ *  - getPage :                 for getting the alias on the image that contains a domain or NULL if no image in the cache contains that domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - updateCache :             for updating the cache according to the cache policy
+ *  - clearCache :              for clearing the cache
+ *
+ * and with 2 functions for concurrent accesses:
+ *
+ *  - shardMutex :              for getting the mutex of the shard of a domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach from the shard of a domain
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyLRU
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aMaxBytes the memory budget of the cache (in bytes).
+     * @param aNbShards the number of shards (the budget is equally
+     * divided between them).
+     */
+    ImageCacheReadPolicyLRU(Alias<ImageFactory> anImageFactory, std::size_t aMaxBytes,
+                            unsigned int aNbShards=1):
+      myShards(aNbShards == 0 ? 1 : aNbShards), myMaxBytes(aMaxBytes), myImageFactory(&anImageFactory)
+    {
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyLRU() {}
+    
+private:
+    
+    ImageCacheReadPolicyLRU( const ImageCacheReadPolicyLRU & other );
+    
+    ImageCacheReadPolicyLRU & operator=( const ImageCacheReadPolicyLRU & other );
+    
+public:
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * The image becomes the most recently used of its shard.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * The image becomes the most recently used of its shard.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached. The image is the
+     * least recently used one of the first shard that has no room
+     * left for a new page, and it is removed from the cache.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Get the alias on the image that we have to detach before
+     * loading the domain aDomain or NULL if no image have to be
+     * detached. Only the shard of aDomain is considered.
+     *
+     * @param aDomain the domain of the page to load.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach(const Domain & aDomain);
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+    
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+    
+    /**
+     * @param aDomain a domain.
+     * @return the mutex of the shard of aDomain.
+     */
+    std::mutex & shardMutex(const Domain & aDomain);
+    
+    /**
+     * @return the number of shards.
+     */
+    unsigned int nbShards() const;
+    
+    /**
+     * @return the memory (in bytes) used by the pages of the cache.
+     */
+    std::size_t usedBytes() const;
+    
+    /**
+     * @param aDomain the domain of a page.
+     * @return the memory (in bytes) of the page.
+     */
+    static std::size_t pageBytes(const Domain & aDomain);
+    
+protected:
+    
+    /**
+     * A shard of the cache.
+     */
+    struct Shard
+    {
+      /// Pages of the shard, the most recently used at the front
+      std::list <ImageContainer *> myPages;
+      
+      /// Memory used by the pages of the shard
+      std::size_t myBytes = 0;
+      
+      /// Memory of the largest page ever loaded in the shard
+      std::size_t myMaxPageBytes = 0;
+      
+      /// Lock of the shard
+      std::mutex myMutex;
+    };
+    
+    /**
+     * @param aDomain a domain.
+     * @return the shard of aDomain.
+     */
+    Shard & shard(const Domain & aDomain);
+    
+    /**
+     * Removes the least recently used page of the shard aShard if
+     * there is no room left for a new page.
+     *
+     * @param aShard a shard.
+     * @return the alias on the removed image container or NULL pointer.
+     */
+    ImageContainer * evict(Shard & aShard);
+    
+    /// Shards of the cache
+    std::vector <Shard> myShards;
+    
+    /// Memory budget of the cache
+    std::size_t myMaxBytes;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyLRU
+
 /////////////////////////////////////////////////////////////////////////////
 // Template class ImageCacheWritePolicyWT
 /**
@@ -349,6 +560,7 @@ protected:
  * 
  * Initially, writing is done only to the cache. The write to the disk is postponed 
  * until the cache blocks containing the data are about to be modified/replaced by new content.
+ * With ImageFactoryAsync, the pages are flushed in the background.
  * 
  * @tparam TImageContainer an image container type (model of CImage).
  * @tparam TImageFactory an image factory.
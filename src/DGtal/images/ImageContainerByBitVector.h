@@ -0,0 +1,372 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBitVector.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByBitVector.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testImageContainerByBitVector.cpp
+ */
+
+#if defined(ImageContainerByBitVector_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBitVector.h
+#else // defined(ImageContainerByBitVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBitVector_RECURSES
+
+#if !defined ImageContainerByBitVector_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBitVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerByBitVector
+  /**
+   * Description of class 'ImageContainerByBitVector' <p>
+   *
+   * Aim: Model of CImage implementing a binary image (values of type
+   * bool) with one bit per point, stored in 64-bit words.
+   *
+   * Each row of the domain along the first axis is stored in its own
+   * sequence of nbWordsPerRow() words, the bit b of word w of a row
+   * holding the value of its point of abscissa lowerBound[0] + 64w + b
+   * (unused bits of the last word are always zero). Each row is
+   * padded with a zero word on both sides and the rows are surrounded
+   * by zero rows (one on each side along every axis but the first),
+   * so that the neighbors of any point of the domain can be read
+   * without bound checks. Hence, besides
+   * the usual point accesses, whole rows may be read and written
+   * word by word with rowWords(), the number of true values is
+   * computed by popcounts (count()), and the 3x3 (2D) or 3x3x3 (3D)
+   * configuration of the neighbors of a point is extracted with a few
+   * shifts of three (2D) or nine (3D) rows, without branches
+   * (getNeighborhoodConfiguration()), in the bit order of
+   * NeighborhoodConfigurations tables.
+   *
+   * @code
+   * ImageContainerByBitVector<Z3i::Domain> image( domain );
+   * image.setValue( p, true );
+   * auto table = functions::loadTable( simplicity::tableSimple26_6 );
+   * bool simple = (*table)[ image.getNeighborhoodConfiguration( p ) ];
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   *
+   * @see testImageContainerByBitVector.cpp
+   */
+  template <typename TDomain>
+  class ImageContainerByBitVector
+  {
+  public:
+
+    typedef ImageContainerByBitVector<TDomain> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// range of values
+    typedef bool Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// The type of the words storing the bits.
+    typedef DGtal::uint64_t Word;
+    /// The number of bits of a word.
+    static const unsigned int wordBits = 64;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor from a Domain. All values are false.
+     *
+     * @param aDomain the image domain.
+     */
+    ImageContainerByBitVector ( const Domain &aDomain );
+
+    /**
+     * Copy constructor
+     * @param other the object to copy.
+     */
+    ImageContainerByBitVector ( const ImageContainerByBitVector & other ) = default;
+
+    /**
+     * Assignment operator
+     * @param other the object to copy.
+     * @return a reference on *this
+     */
+    ImageContainerByBitVector& operator= ( const ImageContainerByBitVector & other ) = default;
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByBitVector() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     * @pre the point must be in the domain
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     * @pre @c it must be a point in the image domain.
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue ( const Point &aPoint, const Value &aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    Range range();
+
+    // ----------------------- Word services --------------------------------------
+  public:
+
+    /**
+     * @return the number of words of each row.
+     */
+    Size nbWordsPerRow() const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return a pointer on the nbWordsPerRow() words of the row of
+     * @a aPoint (along the first axis). The zero words before and
+     * after them may be read.
+     */
+    const Word* rowWords( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return a pointer on the nbWordsPerRow() words of the row of
+     * @a aPoint (along the first axis).
+     * @note the unused bits of the last word, the words before and
+     * after the row, must be kept to zero.
+     */
+    Word* rowWords( const Point & aPoint );
+
+    /**
+     * Sets all values of the image.
+     * @param aValue the value.
+     */
+    void fill( const Value & aValue );
+
+    /**
+     * @return the number of true values of the image (by popcounts).
+     */
+    Size count() const;
+
+    /**
+     * @return the distance, in words, between the rows of two
+     * consecutive points along the second axis (nbWordsPerRow() plus
+     * the two padding words).
+     */
+    Size rowStride() const;
+
+    /**
+     * @return the distance, in words, between the rows of two
+     * consecutive points along the third axis (0 in 2D).
+     */
+    Size sliceStride() const;
+
+    /**
+     * Computes the configuration of the neighbors of @a aPoint (its
+     * 8 neighbors in 2D, its 26 neighbors in 3D), points out of the
+     * domain being false. The bit order is the one of
+     * functions::mapZeroPointNeighborhoodToConfigurationMask, hence
+     * the configuration indexes the tables of NeighborhoodTables.h
+     * as Object::getNeighborhoodConfigurationOccupancy. It is
+     * computed by functions::getNeighborhoodConfigurationOccupancy.
+     *
+     * @param aPoint any point of the domain.
+     * @return the configuration of its neighbors.
+     * @pre dimension is 2 or 3.
+     */
+    NeighborhoodConfiguration getNeighborhoodConfiguration( const Point & aPoint ) const;
+
+    /**
+     * Computes at once the true points of the image whose neighborhood
+     * configuration (see getNeighborhoodConfiguration()) belongs to a
+     * table, e.g. all the simple points with a simplicity table. The
+     * 64 points of each word are tested together by
+     * functions::getSimplePointsOfWord: the neighbors are obtained by
+     * shifting the neighboring rows, the points whose neighbors are
+     * all true or all false are decided without lookup, and only the
+     * configurations of the other points are looked up in the table.
+     * A small image (e.g. a block of 8x8x8 points, the padding
+     * being its empty halo) or a whole image are processed alike.
+     *
+     * @code
+     * const auto & table = functions::loadSharedTable( simplicity::tableSimple26_6 );
+     * ImageContainerByBitVector<Z3i::Domain> simple = image.getSimplePoints( table );
+     * @endcode
+     *
+     * @param table any table [configuration] -> bool, of size 2^26
+     * (3D) or 2^8 (2D).
+     * @param parallel when 'true' and OpenMP is available, the rows are
+     * processed in parallel.
+     * @return the binary image (with the same domain) of these points.
+     * @pre dimension is 2 or 3.
+     */
+    Self getSimplePoints( const boost::dynamic_bitset<> & table,
+                          bool parallel = false ) const;
+
+    /**
+     * @return the number of bytes used by the image.
+     */
+    std::size_t memoryUsage() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    // ------------- realization CDrawableWithBoard2D --------------------
+  public:
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Image domain
+    Domain myDomain;
+
+    ///Domain extent (stored for linearization efficiency)
+    Vector myExtent;
+
+    /// Number of words of each row.
+    Size myWordsPerRow;
+
+    /// Number of words between two consecutive rows along the second axis.
+    Size myRowStride;
+
+    /// Number of words between two consecutive rows along the third axis.
+    Size mySliceStride;
+
+    /// The words of the rows, with their padding words and zero rows.
+    std::vector<Word> myWords;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the index of the first word of its row.
+     */
+    Size rowIndex( const Point & aPoint ) const;
+
+    /**
+     * @param r the index of a row of myWords.
+     * @return 'true' iff it is one of the zero rows around the domain.
+     */
+    bool isPaddingRow( Size r ) const;
+
+  }; // end of class ImageContainerByBitVector
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBitVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBitVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByBitVector<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByBitVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBitVector_h
+
+#undef ImageContainerByBitVector_RECURSES
+#endif // else defined(ImageContainerByBitVector_RECURSES)
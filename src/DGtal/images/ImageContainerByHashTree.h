@@ -42,6 +42,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CLabel.h"
 #include "DGtal/base/ConstRangeAdapter.h"
@@ -116,6 +118,27 @@ namespace DGtal
    * The method isKeyValid(..) is provided to verify the validity of a
    * key. Note that using this security strongly affects performances.
    *
+   * The nodes (pairs key/value) are stored in open addressing hash
+   * tables with linear probing: each table is a single contiguous
+   * array of nodes, so that no node is allocated on its own and
+   * accesses do not chase pointers. The tree may be built at once
+   * from a dense image by a traversal in Morton order
+   * (buildFromImage()).
+   *
+   * Several threads may set values at the same time between
+   * startConcurrentSetValue() and endConcurrentSetValue(): the tree is
+   * then cut into subtrees at a fixed depth, whose nodes are stored in
+   * a few tables (stripes) protected by their own locks.
+   *
+   * @code
+   * ImageContainerByHashTree<Z3i::Domain, int> image( domain );
+   * image.startConcurrentSetValue();
+   * #pragma omp parallel for
+   * for ( int i = 0; i < n; ++i )
+   *   image.concurrentSetValue( points[ i ], labels[ i ] );
+   * image.endConcurrentSetValue();
+   * @endcode
+   *
    * @tparam TDomain type of domains
    * @tparam TValue type for image values
    * @tparam THashKey  type to store Morton keys
@@ -130,6 +153,7 @@ namespace DGtal
 
   protected:
     class Node;
+    class NodeTable;
 
 
   public:
@@ -176,11 +200,9 @@ namespace DGtal
      * The constructor from a \a hashKeySize, a @a depth and a
      * @a defaultValue.
      *
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here.
+     * @param hashKeySize Number of bit of the hash key. A value K
+     * creates a hash table of initial length 2^K, which grows with the
+     * number of nodes.
      *
      * @param depth Determines the maximum depth of the tree and thus
      * qthe "size" of the image. Each span then extends from 0 to
@@ -199,11 +221,9 @@ namespace DGtal
      * of the tree is given by the logarithm of the domain size
      * defined by the two points.
      *
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here.
+     * @param hashKeySize Number of bit of the hash key. A value K
+     * creates a hash table of initial length 2^K, which grows with the
+     * number of nodes.
      *
      * @param p1 First point of the image bounding box.
      * @param p2 Second point of the image bounding box.
@@ -223,11 +243,9 @@ namespace DGtal
      * defined by the two points.
      *
      * @param aDomain the image domain
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here (default: 3).
+     * @param hashKeySize Number of bit of the hash key. A value K
+     * creates a hash table of initial length 2^K, which grows with the
+     * number of nodes (default: 3).
      *
      * @param defaultValue In order for the tree to be valid it needs
      * a default value at the root (key = 1)
@@ -361,6 +379,59 @@ namespace DGtal
      */
     void setValue(const Point& aPoint, const Value object);
 
+    /**
+     * Builds the tree from the values of a dense image, replacing
+     * the current values. The leaves are visited in Morton order and
+     * the subtrees whose leaves have the same value are stored as a
+     * single node, so that no node is ever removed.
+     *
+     * @param anImage any image (points outside of its domain get
+     * the value @a outsideValue).
+     * @param outsideValue the value of the points outside of the
+     * domain of @a anImage.
+     * @tparam TImage a model of CConstImage with the same Point and Value.
+     */
+    template <typename TImage>
+    void buildFromImage( const TImage & anImage,
+                         const Value outsideValue = NumberTraits<Value>::ZERO );
+
+    /**
+     * Prepares the tree to concurrent calls to concurrentSetValue.
+     * The tree is cut into subtrees at the smallest depth giving at
+     * least 64 subtrees per stripe (the leaves above this depth are
+     * split), and the nodes of the subtrees are distributed over @a
+     * nbStripes hash tables, each protected by its own lock.
+     *
+     * @param nbStripes the number of stripes (rounded up to a power
+     * of two, 0 is for 64).
+     */
+    void startConcurrentSetValue( unsigned int nbStripes = 0 );
+
+    /**
+     * Sets the value at a point as setValue, but may be called by
+     * several threads at the same time between
+     * startConcurrentSetValue() and endConcurrentSetValue(). Only the
+     * stripe of the subtree of the point is locked. The brothers
+     * above the cut depth are not merged before endConcurrentSetValue().
+     *
+     * @param aPoint The point
+     * @param object the associated object
+     * @note no value should be read during concurrent writes.
+     */
+    void concurrentSetValue( const Point & aPoint, const Value object );
+
+    /**
+     * Ends the concurrent writes: merges the brothers above the cut
+     * depth having the same value. The nodes stay distributed over
+     * the stripes.
+     */
+    void endConcurrentSetValue();
+
+    /**
+     * @return the number of bytes used by the tree.
+     */
+    std::size_t memoryUsage() const;
+
     /**
      * Returns the size of a dimension (the container represents a
      * line, a square, a cube, etc. depending on the dimmension so no
@@ -495,24 +566,18 @@ namespace DGtal
     class Iterator
     {
     public:
-      Iterator(Node** data, unsigned int position, unsigned int arraySize)
+      Iterator(std::vector<NodeTable>* tables, unsigned int table, unsigned int position)
+        : myTables( tables ), myTable( table ), myCurrentCell( position )
       {
-        myArraySize = arraySize;
-        myContainerData = data;
-        myNode = data[0];
-        myCurrentCell = position;
-        while ((!myNode) && (myCurrentCell < myArraySize))
-          {
-            myNode = myContainerData[++myCurrentCell];
-          }
+        skipEmptyCells();
       }
       bool isAtEnd()const
       {
-        return myCurrentCell >= myArraySize;
+        return myTable >= myTables->size();
       }
       Value& operator*()
       {
-        return myNode->getObject();
+        return myNode()->getObject();
       }
       bool operator ++ ()
       {
@@ -523,25 +588,28 @@ namespace DGtal
         if (isAtEnd() && it.isAtEnd())
           return true;
         else
-          return (myNode == it.myNode);
+          return (myTable == it.myTable) && (myCurrentCell == it.myCurrentCell);
       }
       bool operator != (const Iterator& it)
       {
-        if (isAtEnd() && it.isAtEnd())
-          return false;
-        else
-          return (myNode != it.myNode);
+        return ! ( *this == it );
       }
       inline HashKey getKey() const
       {
-        return myNode->getKey();
+        return myNode()->getKey();
       }
       bool next();
     protected:
-      Node* myNode;
+      /// Moves to the first node from the current cell.
+      void skipEmptyCells();
+      /// @return the current node.
+      Node* myNode() const
+      {
+        return (*myTables)[ myTable ].data() + myCurrentCell;
+      }
+      std::vector<NodeTable>* myTables;
+      unsigned int myTable;
       unsigned int myCurrentCell;
-      unsigned int myArraySize;
-      Node** myContainerData;
     };
 
     /**
@@ -549,7 +617,7 @@ namespace DGtal
      */
     Iterator begin()
     {
-      return Iterator(myData, 0, myArraySize);
+      return Iterator(&myTables, 0, 0);
     }
 
     /**
@@ -557,7 +625,7 @@ namespace DGtal
      */
     Iterator end()
     {
-      return Iterator(myData, myArraySize, myArraySize);
+      return Iterator(&myTables, (unsigned int) myTables.size(), 0);
     }
 
     void selfDisplay(std::ostream & out) const;
@@ -594,13 +662,19 @@ namespace DGtal
     /**
      * @class Node
      *
-     * An internal class that corresponds to a node of a linked list (as the hashTable points to linked
-     * lists to handle collisions). Each element in the container is placed in a Node.
+     * An internal class that corresponds to a cell of a hash table.
+     * Each element in the container is placed in a Node, and an empty
+     * cell has the (invalid) key 0.
      */
     class Node
     {
     public:
 
+      /**
+       * Construtctor of an empty cell.
+       */
+      Node() : myKey( 0 ), myData() {}
+
       /**
        * Construtctor: create pair (@a aValue, @a key)
        *
@@ -613,30 +687,11 @@ namespace DGtal
         myKey = key;
       }
 
-      /**
-       * @return the next pair (aValue, key) in the list.
-       */
-      inline Node* getNext()
-      {
-        return myNext;
-      }
-
-
-      /**
-       * Insert the pair (value,key)  @a next in the node list
-       *
-       * @param next a pointer to a pair (value,key) (Node).
-       */
-      inline void setNext(Node* next)
-      {
-        myNext = next;
-      }
-
       /**
        *
        * @return the key associated to a Node.
        */
-      inline HashKey getKey()
+      inline HashKey getKey() const
       {
         return myKey;
       }
@@ -652,20 +707,176 @@ namespace DGtal
       ~Node() { }
     protected:
       HashKey myKey;
-      Node* myNext;
       Value myData;
     };// -----------------------------------------------------------
 
-
+    // -------------------------------------------------------------
     /**
-     * This is part of the hash function. It is called whenever a key
-     * is accessed.  The mask used to compute the result is
-     * precomputed in the constructor for efficiency.
+     * @class NodeTable
      *
-     * @param key a node in the hashtree.
+     * An internal class implementing an open addressing hash table of
+     * nodes with linear probing. Its cells are stored in a single
+     * array whose size is a power of two, at most 3/4 of them being
+     * used. Removals shift back the following nodes of the probe
+     * sequence, so that there are no tombstones.
+     */
+    class NodeTable
+    {
+    public:
+
+      /**
+       * Constructor.
+       * @param logSize the initial number of cells is 2^logSize.
+       */
+      NodeTable( unsigned int logSize = 3 )
+      {
+        reset( logSize );
+      }
+
+      /**
+       * Removes all the nodes.
+       * @param logSize the number of cells is 2^logSize.
+       */
+      void reset( unsigned int logSize )
+      {
+        myLogSize = std::max( logSize, 1u );
+        myNodes.assign( std::size_t( 1 ) << myLogSize, Node() );
+        mySize = 0;
+      }
+
+      /**
+       * @param key any valid key.
+       * @return a pointer to its node, or 0.
+       */
+      inline Node* find( const HashKey key ) const
+      {
+        const std::size_t mask = myNodes.size() - 1;
+        for ( std::size_t i = home( key ); ; i = ( i + 1 ) & mask )
+          {
+            const HashKey k = myNodes[ i ].getKey();
+            if ( k == key ) return const_cast<Node*>( myNodes.data() + i );
+            if ( k == 0 )   return 0;
+          }
+      }
+
+      /**
+       * Sets the value of a key, inserting its node if necessary.
+       * @param key any valid key.
+       * @param object its value.
+       * @return a pointer to its node (valid until the next insertion).
+       */
+      Node* insert( const HashKey key, const Value object )
+      {
+        if ( 4 * ( mySize + 1 ) > 3 * myNodes.size() )
+          grow();
+        const std::size_t mask = myNodes.size() - 1;
+        std::size_t i = home( key );
+        for ( ; myNodes[ i ].getKey() != 0; i = ( i + 1 ) & mask )
+          if ( myNodes[ i ].getKey() == key )
+            {
+              myNodes[ i ].getObject() = object;
+              return myNodes.data() + i;
+            }
+        myNodes[ i ] = Node( object, key );
+        ++mySize;
+        return myNodes.data() + i;
+      }
+
+      /**
+       * Removes the node of a key.
+       * @param key any valid key.
+       * @return 'false' if the key has no node.
+       */
+      bool erase( const HashKey key )
+      {
+        Node* n = find( key );
+        if ( ! n ) return false;
+        const std::size_t mask = myNodes.size() - 1;
+        std::size_t i = n - myNodes.data();
+        for ( std::size_t j = ( i + 1 ) & mask; myNodes[ j ].getKey() != 0;
+              j = ( j + 1 ) & mask )
+          {
+            // The node of j moves to the hole i if its home cell is
+            // not cyclically in ]i,j].
+            const std::size_t h = home( myNodes[ j ].getKey() );
+            if ( ( i <= j ) ? ( h <= i || h > j ) : ( h <= i && h > j ) )
+              {
+                myNodes[ i ] = myNodes[ j ];
+                i = j;
+              }
+          }
+        myNodes[ i ] = Node();
+        --mySize;
+        return true;
+      }
+
+      /**
+       * @param key any valid key.
+       * @return the index of its home cell.
+       */
+      inline std::size_t home( const HashKey key ) const
+      {
+        // Fibonacci hashing spreads the regular Morton keys.
+        return std::size_t( ( static_cast<DGtal::uint64_t>( key )
+                              * 0x9E3779B97F4A7C15ULL ) >> ( 64 - myLogSize ) );
+      }
+
+      /// @return the number of nodes.
+      std::size_t size() const { return mySize; }
+      /// @return the number of cells.
+      std::size_t capacity() const { return myNodes.size(); }
+      /// @return the cells.
+      Node* data() { return myNodes.data(); }
+      /// @return the cells.
+      const Node* data() const { return myNodes.data(); }
+
+    protected:
+      /// Doubles the number of cells.
+      void grow()
+      {
+        std::vector<Node> old;
+        old.swap( myNodes );
+        reset( myLogSize + 1 );
+        for ( std::size_t i = 0; i < old.size(); ++i )
+          if ( old[ i ].getKey() != 0 )
+            insert( old[ i ].getKey(), old[ i ].getObject() );
+      }
+
+      /// The cells.
+      std::vector<Node> myNodes;
+      /// The number of nodes.
+      std::size_t mySize;
+      /// The number of cells is 2^myLogSize.
+      unsigned int myLogSize;
+    };// -----------------------------------------------------------
+
+    /**
+     * A lock of the stripes of concurrentSetValue. Copies give new
+     * unlocked locks, so that the container stays copyable.
      */
-    inline HashKey getIntermediateKey(const HashKey key) const;
+    struct StripeLock
+    {
+      StripeLock() {}
+      StripeLock( const StripeLock & ) {}
+      StripeLock& operator=( const StripeLock & ) { return *this; }
+      std::mutex myMutex;
+    };
 
+    /**
+     * @param key any valid key.
+     * @return the index of the table storing the key.
+     */
+    inline unsigned int getTableIndex( const HashKey key ) const
+    {
+      if ( myTables.size() == 1 ) return 0;
+      // The table is given by the ancestor (or the first descendant)
+      // of the key at the cut depth.
+      const unsigned int depth = getKeyDepth( key );
+      const HashKey cut = ( depth >= myCutDepth )
+        ? key >> ( dim * ( depth - myCutDepth ) )
+        : key << ( dim * ( myCutDepth - depth ) );
+      return (unsigned int)( cut & ( myTables.size() - 1 ) );
+    }
 
     /**
      * Add a Node to the tree.  This method is very used when writing
@@ -674,22 +885,11 @@ namespace DGtal
      *
      * @param object a object (value)
      * @param key a hashtree key
-     * @return a pointer to the node list.
+     * @return a pointer to the node (valid until the next insertion).
      */
     Node* addNode(const Value object, const HashKey key)
     {
-      Node* n = getNode(key);
-      if (n)
-        {
-          n->getObject() = object;
-          //n->setObject(object);
-          return n;
-        }
-      n = new Node(object, key);
-      HashKey key2 = getIntermediateKey(key);
-      n->setNext(myData[key2]);
-      myData[key2] = n;
-      return n;
+      return myTables[ getTableIndex( key ) ].insert( key, object );
     }
 
   public:
@@ -702,14 +902,7 @@ namespace DGtal
      */
     inline Node* getNode(const HashKey key)  const  // very used !! // public because Display2DFactory !!!
     {
-      Node* iter = myData[getIntermediateKey(key)];
-      while (iter != 0)
-        {
-          if (iter->getKey() == key)
-            return iter;
-          iter = iter->getNext();
-        }
-      return 0;
+      return myTables[ getTableIndex( key ) ].find( key );
     }
   protected:
 
@@ -727,6 +920,36 @@ namespace DGtal
      */
     void recursiveRemoveNode(HashKey key, unsigned int nbRecursions);
 
+    /**
+     * Sets the value of a key as setValue, without merging nor
+     * looking for a leaf above the depth @a minDepth.
+     * @param key The key (deeper than @a minDepth).
+     * @param object The associated object
+     * @param minDepth the depth at which the tree is cut.
+     */
+    void setValueBelow(const HashKey key, const Value object, unsigned int minDepth);
+
+    /**
+     * Builds recursively the subtree of a key from an image.
+     * @param anImage the image.
+     * @param key the key of the subtree.
+     * @param corner the lowest point of the subtree.
+     * @param depth the depth of the key.
+     * @param outsideValue the value of the points out of the image domain.
+     * @param value (returns) the value of the subtree if it is uniform.
+     * @return 'true' iff all the leaves of the subtree have the same value.
+     */
+    template <typename TImage>
+    bool buildSubtree( const TImage & anImage, const HashKey key, const Point & corner,
+                       const unsigned int depth, const Value & outsideValue, Value & value );
+
+    /**
+     * Distributes the nodes over new tables.
+     * @param nbTables the number of tables (a power of two).
+     * @param cutDepth the depth giving the table of a key.
+     */
+    void distributeNodes( unsigned int nbTables, unsigned int cutDepth );
+
 
     /**
      * Set the (maximum) depth of the tree and precompute a mask used
@@ -754,18 +977,26 @@ namespace DGtal
     Domain myDomain;
 
     /**
-     * The array of linked lists containing all the data
+     * The hash tables containing all the data (the table of a key is
+     * given by getTableIndex).
      */
-    Node** myData;
+    std::vector<NodeTable> myTables;
 
     /**
-     * The size of the intermediate hashkey. The bigger the less
-     * collisions, but at the same time the more chances to have
-     * unused memory allocated.
+     * The locks of the tables for concurrentSetValue.
      */
-    unsigned int myKeySize;
+    std::vector<StripeLock> myLocks;
+
+    /**
+     * The depth at which the tree is cut into subtrees stored in
+     * the different tables.
+     */
+    unsigned int myCutDepth;
 
-    unsigned int myArraySize;
+    /**
+     * The initial size of the hash tables is 2^myKeySize.
+     */
+    unsigned int myKeySize;
 
     /**
      * The depth of the tree
@@ -787,7 +1018,6 @@ namespace DGtal
      * Precoputed masks to avoid recalculating it all the time
      */
     HashKey myDepthMask;
-    HashKey myPreComputedIntermediateMask; // ~((~0) << _keySize)
 
   public:
     ///The morton code computer.
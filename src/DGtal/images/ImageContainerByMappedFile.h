@@ -0,0 +1,423 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMappedFile.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByMappedFile.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testMappedFileReader.cpp
+ */
+
+#if defined(ImageContainerByMappedFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMappedFile.h
+#else // defined(ImageContainerByMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMappedFile_RECURSES
+
+#if !defined ImageContainerByMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <cstdint>
+#include <iterator>
+#include "boost/iterator/iterator_facade.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
+#include "DGtal/base/SimpleRandomAccessRangeFromPoint.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerByMappedFile
+  /**
+   * Description of class 'ImageContainerByMappedFile' <p>
+   *
+   * Aim: Model of CImage whose values are the uncompressed payload of
+   * a file (e.g. a raw file, or a vol file of version 2) mapped in
+   * memory, instead of being copied in a buffer.
+   *
+   * The payload starts at a given offset of the file and holds the
+   * values of the domain points in the order of
+   * ImageContainerBySTLVector (linearized(), the first axis being the
+   * fastest), each value being stored as a little-endian Value. Only
+   * the pages of the file which are accessed are loaded by the system,
+   * and they are released under memory pressure, hence an image larger
+   * than the memory can be read (and written) without any copy.
+   *
+   * The mapping is read-only by default: setValue() and range() may
+   * only be used on a writable mapping, whose modifications are
+   * written back to the file by the system (see flush()). Copies of the
+   * image share the same mapping, which is released with the last copy.
+   *
+   * Images are usually created by MappedFileReader (or GenericReader):
+   * @code
+   * typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> Image;
+   * Image image = MappedFileReader<Image>::importVol( "lobster.vol" );
+   * @endcode
+   *
+   * The payload may start at any offset of the file, e.g. just after
+   * the text header of a longvol file: the values are read and written
+   * with memcpy (a plain load or store on common hosts), and the
+   * iterators of the ranges do the same, so that unaligned payloads
+   * are supported. data() may only be used when the payload is
+   * aligned (see isAligned()).
+   *
+   * @note the file is accessed through mmap (POSIX) or
+   * MapViewOfFile (Windows). Multi-byte values need a little-endian host.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue the (trivially copyable) type of the stored values.
+   *
+   * @see MappedFileReader
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMappedFile
+  {
+  public:
+
+    typedef ImageContainerByMappedFile<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// range of values
+    typedef TValue Value;
+    typedef std::ptrdiff_t Difference;
+
+    /**
+     * A reference on a value of the payload, which is read and written
+     * with memcpy since the payload may not be aligned.
+     */
+    class ValueReference
+    {
+    public:
+      /// Constructor from the address of the value.
+      explicit ValueReference( char * anAddress ) : myAddress( anAddress ) {}
+      /// @return the referenced value.
+      operator Value() const
+      {
+        Value v;
+        std::memcpy( &v, myAddress, sizeof( Value ) );
+        return v;
+      }
+      /// Writes @a aValue. @return a reference on *this.
+      ValueReference & operator=( const Value & aValue )
+      {
+        std::memcpy( myAddress, &aValue, sizeof( Value ) );
+        return *this;
+      }
+      /// Writes the value referenced by @a other. @return a reference on *this.
+      ValueReference & operator=( const ValueReference & other )
+      {
+        return *this = Value( other );
+      }
+    private:
+      char * myAddress;
+    };
+
+    /**
+     * A random access iterator on the values of the payload, whose
+     * dereference is a Value (read-only) or a ValueReference.
+     *
+     * @tparam TByte either char or const char.
+     * @tparam TReference either Value or ValueReference.
+     */
+    template <typename TByte, typename TReference>
+    class PayloadIterator
+      : public boost::iterator_facade< PayloadIterator<TByte, TReference>, Value,
+                                       std::random_access_iterator_tag, TReference >
+    {
+    public:
+      PayloadIterator() : myAddress( 0 ) {}
+      /// Constructor from the address of a value.
+      explicit PayloadIterator( TByte * anAddress ) : myAddress( anAddress ) {}
+      /// Conversion from a mutable iterator.
+      template <typename TOtherByte, typename TOtherReference>
+      PayloadIterator( const PayloadIterator<TOtherByte, TOtherReference> & other )
+        : myAddress( other.address() ) {}
+      /// @return the address of the value.
+      TByte * address() const { return myAddress; }
+    private:
+      friend class boost::iterator_core_access;
+      static Value reference( const char * anAddress, Value* )
+      {
+        Value v;
+        std::memcpy( &v, anAddress, sizeof( Value ) );
+        return v;
+      }
+      static ValueReference reference( char * anAddress, ValueReference* )
+      {
+        return ValueReference( anAddress );
+      }
+      TReference dereference() const
+      {
+        return reference( myAddress, static_cast<TReference*>( 0 ) );
+      }
+      template <typename TOtherByte, typename TOtherReference>
+      bool equal( const PayloadIterator<TOtherByte, TOtherReference> & other ) const
+      {
+        return myAddress == other.address();
+      }
+      void increment() { myAddress += sizeof( Value ); }
+      void decrement() { myAddress -= sizeof( Value ); }
+      void advance( std::ptrdiff_t n ) { myAddress += n * std::ptrdiff_t( sizeof( Value ) ); }
+      template <typename TOtherByte, typename TOtherReference>
+      std::ptrdiff_t distance_to( const PayloadIterator<TOtherByte, TOtherReference> & other ) const
+      {
+        return ( other.address() - myAddress ) / std::ptrdiff_t( sizeof( Value ) );
+      }
+      TByte * myAddress;
+    };
+
+    typedef PayloadIterator<const char, Value> ConstIterator;
+    typedef PayloadIterator<char, ValueReference> Iterator;
+    typedef SimpleRandomAccessConstRangeFromPoint<ConstIterator, DistanceFunctorFromPoint<Self> > ConstRange;
+    typedef SimpleRandomAccessRangeFromPoint<ConstIterator, Iterator, DistanceFunctorFromPoint<Self> > Range;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Maps the payload of a file.
+     *
+     * @param aFilename the name of the file.
+     * @param aDomain the image domain.
+     * @param anOffset the position of the payload in the file (in bytes).
+     * @param aWritable when 'true', the file is mapped in read-write mode.
+     *
+     * @throw IOException if the file cannot be opened or mapped, or if
+     * it is too short.
+     */
+    ImageContainerByMappedFile ( const std::string & aFilename,
+                                 const Domain & aDomain,
+                                 std::size_t anOffset = 0,
+                                 bool aWritable = false );
+
+    /**
+     * Copy constructor. The copy shares the mapping of @a other.
+     * @param other the object to copy.
+     */
+    ImageContainerByMappedFile ( const ImageContainerByMappedFile & other ) = default;
+
+    /**
+     * Assignment operator. The image shares the mapping of @a other.
+     * @param other the object to copy.
+     * @return a reference on *this
+     */
+    ImageContainerByMappedFile& operator= ( const ImageContainerByMappedFile & other ) = default;
+
+    /**
+     * Destructor. The mapping is released with its last image.
+     */
+    ~ImageContainerByMappedFile() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     * @pre the point must be in the domain
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     * @pre @c it must be a point in the image domain.
+     * @pre the mapping is writable.
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue ( const Point &aPoint, const Value &aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     * @pre the mapping is writable.
+     */
+    Range range();
+
+    /**
+     * Compute the linearized offset of a point in the payload.
+     * @param aPoint a point of the domain.
+     * @return the index of its value in the payload.
+     */
+    Size linearized ( const Point & aPoint ) const;
+
+    /**
+     * @return 'true' if the payload is aligned on the alignment of
+     * Value, i.e. if it can be accessed through data().
+     */
+    bool isAligned() const;
+
+    /**
+     * @return a pointer on the first value of the payload.
+     * @pre the payload is aligned (see isAligned()).
+     */
+    const Value* data() const;
+
+    /**
+     * @return a pointer on the first value of the payload.
+     * @pre the mapping is writable and the payload is aligned.
+     */
+    Value* data();
+
+    /**
+     * @return 'true' if the file is mapped in read-write mode.
+     */
+    bool isWritable() const;
+
+    /**
+     * Writes the modified values to the file, without waiting for the
+     * system to do it.
+     */
+    void flush();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    // ------------- realization CDrawableWithBoard2D --------------------
+  public:
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * A mapped file, unmapped at destruction.
+     */
+    struct Mapping
+    {
+      Mapping( const std::string & aFilename, std::size_t aLength, bool aWritable );
+      ~Mapping();
+
+      /// The name of the file
+      std::string filename;
+      /// The address of the first byte of the file
+      char * address;
+      /// The number of mapped bytes
+      std::size_t length;
+#ifdef _WIN32
+      /// The handles of the file and of its mapping
+      void * fileHandle;
+      void * mappingHandle;
+#endif
+    };
+
+    ///Image domain
+    Domain myDomain;
+
+    ///Domain extent (stored for linearization efficiency)
+    Vector myExtent;
+
+    /// The mapping, shared by the copies of the image
+    std::shared_ptr<Mapping> myMapping;
+
+    /// The first byte of the payload (not necessarily aligned)
+    char * myPayload;
+
+    /// 'true' if the file is mapped in read-write mode
+    bool myWritable;
+
+  }; // end of class ImageContainerByMappedFile
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain, typename Value>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByMappedFile<Domain, Value> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMappedFile_h
+
+#undef ImageContainerByMappedFile_RECURSES
+#endif // else defined(ImageContainerByMappedFile_RECURSES)
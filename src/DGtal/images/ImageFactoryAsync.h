@@ -0,0 +1,318 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryAsync.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageFactoryAsync.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testTiledImage.cpp
+ */
+
+#if defined(ImageFactoryAsync_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryAsync.h
+#else // defined(ImageFactoryAsync_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryAsync_RECURSES
+
+#if !defined ImageFactoryAsync_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryAsync_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <deque>
+#include <list>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImageFactory.h"
+#include "DGtal/base/Alias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryAsync
+  /**
+   * Description of template class 'ImageFactoryAsync' <p>
+   * \brief Aim: implements a factory which performs the requests, the
+   * flushes and the detachments of images of another factory in a
+   * background I/O thread, so that the I/O of an ImageCache (e.g. of a
+   * TiledImage) overlaps the computations.
+   *
+   * - prefetchImage(d) asks for the image of domain d to be produced in
+   *   the background; a following requestImage(d) then returns it
+   *   without waiting (TiledImage iterators call prefetchImage on the
+   *   next tiles, see TiledImage::setPrefetch). At most maxPrefetched
+   *   images wait to be requested, the oldest being detached first;
+   *   the images that requestImage is waiting for are never detached.
+   * - requestImage(d) returns the prefetched image, or waits for it, or
+   *   asks for it in priority.
+   * - flushImage and detachImage return at once, the I/O thread
+   *   flushing then detaching the images in order (write-behind). A
+   *   flushed image must not be modified until it is detached, which
+   *   is the case with ImageCacheWritePolicyWB (a page is flushed just
+   *   before being detached). A request of a domain waits for the
+   *   pending flushes of the images that intersect it.
+   *
+   * All the calls to the underlying factory are made by the I/O
+   * thread, hence it does not need to be thread-safe (e.g.
+   * ImageFactoryFromHDF5).
+   *
+   * @code
+   * ImageFactoryFromHDF5<Image> factoryHDF5(filename, datasetname);
+   * ImageFactoryAsync< ImageFactoryFromHDF5<Image> > factory(factoryHDF5);
+   * ImageCacheReadPolicyLRU<OutputImage, Factory> readPolicy(factory, 1 << 30);
+   * ImageCacheWritePolicyWB<OutputImage, Factory> writePolicy(factory);
+   * TiledImage<Image, Factory, ReadPolicy, WritePolicy> tiledImage(factory, readPolicy, writePolicy, 16);
+   * tiledImage.setPrefetch(2);
+   * @endcode
+   *
+   * @tparam TImageFactory an image factory type (model of CImageFactory).
+   */
+  template <typename TImageFactory>
+  class ImageFactoryAsync
+  {
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryAsync<TImageFactory> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));
+
+    ///Types copied from the factory
+    typedef TImageFactory ImageFactory;
+    typedef typename ImageFactory::Domain Domain;
+    typedef typename ImageFactory::OutputImage OutputImage;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor. Starts the I/O thread.
+     * @param anImageFactory alias on the underlying image factory.
+     * @param aMaxPrefetched the maximal number of prefetched images
+     * waiting to be requested.
+     */
+    ImageFactoryAsync(Alias<ImageFactory> anImageFactory, unsigned int aMaxPrefetched = 8);
+
+    /**
+     * Destructor. Waits for the pending flushes and detachments, stops
+     * the I/O thread and detaches the prefetched images never
+     * requested.
+     */
+    ~ImageFactoryAsync();
+
+  private:
+
+    ImageFactoryAsync( const ImageFactoryAsync & other );
+
+    ImageFactoryAsync & operator=( const ImageFactoryAsync & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myImageFactory->domain();
+    }
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myImageFactory->isValid();
+    }
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain
+     * aDomain, waiting for it if needed.
+     *
+     * @param aDomain the domain.
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage(const Domain &aDomain);
+
+    /**
+     * Asks for the OutputImage of domain aDomain to be created in the
+     * background. Does nothing if it is already prefetched.
+     *
+     * @param aDomain the domain.
+     */
+    void prefetchImage(const Domain &aDomain);
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage in the background.
+     *
+     * @param outputImage the OutputImage, which must not be modified
+     * until it is detached.
+     */
+    void flushImage(OutputImage* outputImage);
+
+    /**
+     * Free (i.e. delete) an OutputImage in the background, after its
+     * pending flushes.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage(OutputImage* outputImage);
+
+    /**
+     * Waits until the I/O thread has nothing left to do.
+     */
+    void wait();
+
+    /**
+     * @return the number of requests served by a prefetched image
+     * (already produced or being produced).
+     */
+    unsigned int getNbPrefetchHits() const;
+
+    // ------------------------- Private Datas --------------------------------
+  protected:
+
+    /**
+     * A task of the I/O thread.
+     */
+    struct Job
+    {
+      enum Type { REQUEST, FLUSH, DETACH };
+
+      Type type;
+      Domain domain;
+      OutputImage * image;
+    };
+
+    /// Alias on the underlying image factory
+    ImageFactory * myImageFactory;
+
+    /// Maximal number of prefetched images waiting to be requested
+    unsigned int myMaxPrefetched;
+
+    /// Pending tasks
+    std::deque<Job> myJobs;
+
+    /// Produced images waiting to be requested, the oldest at the front
+    std::list< std::pair<Domain, OutputImage *> > myReadyImages;
+
+    /// Domains of the pending requests
+    std::list<Domain> myRequestedDomains;
+    /// Domains waited by requestImage, whose images must not be detached
+    std::list<Domain> myWaitedDomains;
+
+    /// Domains of the pending flushes
+    std::list<Domain> myFlushedDomains;
+
+    /// 'true' while the I/O thread performs a task
+    bool myBusy;
+
+    /// 'true' when the I/O thread has to stop
+    bool myStop;
+
+    /// Number of requests served by a prefetched image
+    unsigned int myNbPrefetchHits;
+
+    /// Lock of the data shared with the I/O thread
+    mutable std::mutex myMutex;
+
+    /// Signals a new task to the I/O thread
+    std::condition_variable myJobCondition;
+
+    /// Signals the end of a task
+    std::condition_variable myDoneCondition;
+
+    /// The I/O thread
+    std::thread myThread;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * The loop of the I/O thread.
+     */
+    void run();
+
+    /**
+     * @param aList a list of domains.
+     * @param aDomain a domain.
+     * @return an iterator on the first domain of aList equal to aDomain.
+     */
+    static typename std::list<Domain>::iterator
+    find(std::list<Domain> & aList, const Domain & aDomain);
+
+    /**
+     * @return 'true' if a pending flush concerns an image intersecting aDomain.
+     */
+    bool isFlushPending(const Domain & aDomain) const;
+
+  }; // end of class ImageFactoryAsync
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryAsync'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryAsync' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageFactory>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryAsync<TImageFactory> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryAsync.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryAsync_h
+
+#undef ImageFactoryAsync_RECURSES
+#endif // else defined(ImageFactoryAsync_RECURSES)
@@ -49,11 +49,100 @@
 #include "DGtal/kernel/CInteger.h"
 
 #include "DGtal/base/Bits.h"
+
+#if ( defined(__GNUC__) || defined(__clang__) ) && defined(__x86_64__)
+/// The PDEP/PEXT (BMI2) path of Morton codes may be selected at runtime.
+#define DGTAL_MORTON_WITH_BMI2
+#include <immintrin.h>
+#endif
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Runtime selection of the x86-64 BMI2 instructions PDEP/PEXT
+     * for the dilation and contraction of Morton codes. The path is
+     * enabled when the processor supports it, and may be disabled
+     * (e.g. on processors where PDEP/PEXT are microcoded).
+     *
+     * @tparam T unused, makes the flag definable in a header.
+     */
+    template <typename T = void>
+    struct MortonBMI2
+    {
+      /// true iff PDEP/PEXT are used.
+      static bool enabled;
+
+      /// @return 'true' iff the processor supports BMI2.
+      static bool supported()
+      {
+#ifdef DGTAL_MORTON_WITH_BMI2
+        return __builtin_cpu_supports( "bmi2" );
+#else
+        return false;
+#endif
+      }
+
+#ifdef DGTAL_MORTON_WITH_BMI2
+      __attribute__((target("bmi2")))
+      static DGtal::uint32_t deposit( DGtal::uint32_t x, DGtal::uint32_t mask )
+      { return _pdep_u32( x, mask ); }
+      __attribute__((target("bmi2")))
+      static DGtal::uint64_t deposit( DGtal::uint64_t x, DGtal::uint64_t mask )
+      { return _pdep_u64( x, mask ); }
+      __attribute__((target("bmi2")))
+      static DGtal::uint32_t extract( DGtal::uint32_t x, DGtal::uint32_t mask )
+      { return _pext_u32( x, mask ); }
+      __attribute__((target("bmi2")))
+      static DGtal::uint64_t extract( DGtal::uint64_t x, DGtal::uint64_t mask )
+      { return _pext_u64( x, mask ); }
+#endif
+    };
+
+    template <typename T>
+    bool MortonBMI2<T>::enabled = MortonBMI2<T>::supported();
+
+    /**
+     * Bit dilation and contraction of Morton codes: dilate spreads
+     * the coordBits lowest bits of a value so that the bit i goes to
+     * the bit i*dim, contract is its inverse. This generic version
+     * loops over the bits, specializations for 32/64-bit words in 2D
+     * and 3D use magic masks (or PDEP/PEXT, see MortonBMI2).
+     *
+     * @tparam TWord the type of the Morton codes.
+     * @tparam dim the dimension.
+     */
+    template <typename TWord, Dimension dim>
+    struct MortonDilation
+    {
+      static const unsigned int coordBits = ( sizeof( TWord ) * 8 ) / dim;
+      static const bool hasBMI2 = false;
+
+      template <bool bmi2>
+      static TWord dilate( TWord x )
+      {
+        TWord output = 0;
+        for ( unsigned int i = 0; i < coordBits; ++i )
+          if ( x & ( static_cast<TWord>( 1 ) << i ) )
+            output |= static_cast<TWord>( 1 ) << ( i * dim );
+        return output;
+      }
+
+      template <bool bmi2>
+      static TWord contract( TWord x )
+      {
+        TWord output = 0;
+        for ( unsigned int i = 0; i < coordBits; ++i )
+          if ( x & ( static_cast<TWord>( 1 ) << ( i * dim ) ) )
+            output |= static_cast<TWord>( 1 ) << i;
+        return output;
+      }
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class Morton
   /**
@@ -67,6 +156,11 @@ namespace DGtal
    * Main methods in this class are keyFromCoordinates to generate a
    * key and CoordinatesFromKey to generate a point from a code.
    *
+   * For 32 and 64-bit keys in 2D and 3D, the bits are interleaved
+   * in constant time with magic masks, or with the BMI2 PDEP/PEXT
+   * instructions when the processor supports them (see useBMI2()).
+   * Other cases loop over the bits.
+   *
    * @tparam THashKey type to store the morton code (should have
    * enough capacity to store the interleaved binary word).
    * @tparam TPoint type of points. 
@@ -112,6 +206,24 @@ namespace DGtal
      */
     HashKey keyFromCoordinates(const std::size_t treeDepth, const Point & coordinates) const;
 
+    /**
+     * Computes the keys of a range of points, as keyFromCoordinates.
+     *
+     * @param treeDepth The depth at which the coordinates are to be
+     * read.
+     * @param itb an iterator on the first point.
+     * @param ite an iterator after the last point.
+     * @param out an output iterator on HashKey where the keys are written.
+     * @return the output iterator after the last key.
+     *
+     * @tparam PointIterator a model of forward iterator on Point.
+     * @tparam KeyOutputIterator a model of output iterator on HashKey.
+     */
+    template <typename PointIterator, typename KeyOutputIterator>
+    KeyOutputIterator keysFromCoordinates( const std::size_t treeDepth,
+                                           PointIterator itb, PointIterator ite,
+                                           KeyOutputIterator out ) const;
+
     /**
      * Computes the coordinates correspponding to a key.
      *
@@ -147,12 +259,38 @@ namespace DGtal
      * @param result Will contain the resulting children keys.
      */ 
     void childrenKeys(const HashKey key, HashKey* result ) const;
-    
-  private: 
-    
-    ///@todo Implements dilateMasks
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myDilateMasks;
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myContractMasks;
+
+    /**
+     * @return 'true' iff the bits are interleaved with the BMI2
+     * instructions PDEP/PEXT (by default, iff the processor supports
+     * them and the keys are 32 or 64-bit words in 2D or 3D).
+     */
+    static bool useBMI2();
+
+    /**
+     * Enables or disables the BMI2 instructions for all Morton codes
+     * (they are never enabled if the processor does not support them).
+     *
+     * @param enable when 'true', PDEP/PEXT are used if possible.
+     */
+    static void setUseBMI2( bool enable );
+
+  private:
+
+    /// The dilation of the bits of the coordinates.
+    typedef detail::MortonDilation<HashKey, dimension> Dilation;
+
+    /// The number of bits of each coordinate stored in a key.
+    static const unsigned int coordBits = Dilation::coordBits;
+
+    /**
+     * Interleaves the bits of a point.
+     * @param aPoint the point.
+     * @return the interleaved bits.
+     * @tparam bmi2 when 'true', PDEP is used.
+     */
+    template <bool bmi2>
+    HashKey interleave( const Point & aPoint ) const;
   };
 } // namespace DGtal
 
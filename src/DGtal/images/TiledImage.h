@@ -57,6 +57,32 @@
 
 namespace DGtal
 {
+  namespace detail
+  {
+    /**
+     * Asks an image factory to produce the image of a domain in the
+     * background, when it can (see ImageFactoryAsync::prefetchImage).
+     *
+     * @return 'true' if the factory has a prefetchImage method.
+     */
+    template <typename TImageFactory, typename TDomain>
+    inline
+    auto prefetchImage( TImageFactory & anImageFactory, const TDomain & aDomain, int )
+      -> decltype( anImageFactory.prefetchImage( aDomain ), bool() )
+    {
+      anImageFactory.prefetchImage( aDomain );
+      return true;
+    }
+
+    /// Overload for the factories without prefetchImage method.
+    template <typename TImageFactory, typename TDomain>
+    inline
+    bool prefetchImage( TImageFactory &, const TDomain &, long )
+    {
+      return false;
+    }
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // Template class TiledImage
   /**
@@ -71,6 +97,26 @@ namespace DGtal
    * @note It is important to take into account that read and write policies are passed as aliases in the TiledImage constructor,
    * so for example, if two TiledImage instances are successively created with the same read policy instance,
    * the state of the cache for a given time is therefore the same for the two TiledImage instances !
+   *
+   * When iterating over the image, the tiles that follow the current
+   * one along the iteration direction may be loaded in advance (see
+   * setPrefetch), the read policy having then to keep at least the
+   * current tile and the prefetched ones (e.g. ImageCacheReadPolicyFIFO
+   * or ImageCacheReadPolicyLRU with enough room). With a factory able
+   * to produce images in the background (ImageFactoryAsync), the
+   * prefetched tiles are read while the current one is processed.
+   *
+   * Several threads may read values at the same time with
+   * concurrentRead, provided the read policy is sharded (e.g.
+   * ImageCacheReadPolicyLRU, see ImageCache::concurrentRead).
+   *
+   * @code
+   * MyReadPolicyLRU readPolicy(factory, 1 << 30, 64); // 1GB, 64 shards
+   * MyTiledImage tiledImage(factory, readPolicy, writePolicy, 16);
+   * #pragma omp parallel for
+   * for (int i = 0; i < nbPoints; i++)
+   *   values[i] = tiledImage.concurrentRead(points[i]);
+   * @endcode
    */
   template <typename TImageContainer, typename TImageFactory, typename TImageCacheReadPolicy, typename TImageCacheWritePolicy>
   class TiledImage
@@ -118,7 +164,7 @@ namespace DGtal
                Alias<ImageCacheReadPolicy> aReadPolicy,
                Alias<ImageCacheWritePolicy> aWritePolicy,
                typename Domain::Integer N):
-      myN(N), myImageFactory(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy)
+      myN(N), myImageFactory(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy), myPrefetch(0)
     {
       myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
 
@@ -151,6 +197,7 @@ namespace DGtal
       myImageFactory = other.myImageFactory;
       myReadPolicy = other.myReadPolicy;
       myWritePolicy = other.myWritePolicy;
+      myPrefetch = other.myPrefetch;
 
       myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
 
@@ -174,6 +221,7 @@ namespace DGtal
           myImageFactory = other.myImageFactory;
           myReadPolicy = other.myReadPolicy;
           myWritePolicy = other.myWritePolicy;
+          myPrefetch = other.myPrefetch;
 
           myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
 
@@ -261,7 +309,7 @@ namespace DGtal
       {
         if ( myBlockCoordsIterator != myTiledImage->domainBlockCoords().end() )
           {
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            loadTile( true );
             myTiledRangeIterator = myTile->range().begin();
           }
       }
@@ -281,7 +329,7 @@ namespace DGtal
       {
         if ( myBlockCoordsIterator != myTiledImage->domainBlockCoords().end() )
           {
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            loadTile( true );
             myTiledRangeIterator = myTile->range().begin(aPoint);
           }
       }
@@ -340,7 +388,7 @@ namespace DGtal
             if ( myBlockCoordsIterator == myTiledImage->domainBlockCoords().end() )
               return;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            loadTile( true );
             myTiledRangeIterator = myTile->range().begin();
           }
       }
@@ -380,7 +428,7 @@ namespace DGtal
           {
             myBlockCoordsIterator--;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            loadTile( false );
 
             myTiledRangeIterator = myTile->range().end();
             myTiledRangeIterator--;
@@ -403,7 +451,7 @@ namespace DGtal
 
             myBlockCoordsIterator--;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            loadTile( false );
 
             myTiledRangeIterator = myTile->range().end();
             myTiledRangeIterator--;
@@ -433,6 +481,44 @@ namespace DGtal
       }
 
     private:
+      /**
+       * Sets the current tile to the one of the current block coords,
+       * and prefetches the next tiles along the iteration direction.
+       *
+       * @param forward 'true' for a forward iteration, 'false' for a
+       * backward one.
+       */
+      inline
+      void loadTile( bool forward )
+      {
+        myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+
+        if ( myTiledImage->getPrefetch() == 0 )
+          return;
+
+        BlockCoordsIterator it = myBlockCoordsIterator;
+        for ( unsigned int i = 0; i < myTiledImage->getPrefetch(); i++ )
+          {
+            if ( forward )
+              {
+                ++it;
+                if ( it == myTiledImage->domainBlockCoords().end() )
+                  break;
+              }
+            else
+              {
+                if ( it == myTiledImage->domainBlockCoords().begin() )
+                  break;
+                --it;
+              }
+
+            myTiledImage->prefetch( (*it) );
+          }
+
+        // the current tile may have been detached by a too small cache
+        myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+      }
+
       /// TiledImage pointer
       const TiledImage *myTiledImage;
 
@@ -697,6 +783,43 @@ namespace DGtal
       return tile;
     }
 
+    /**
+     * Loads the tile of block coords aCoord in the cache if it is not
+     * there yet (without counting a cache miss), or asks the factory
+     * to produce it in the background if it can (see
+     * ImageFactoryAsync).
+     *
+     * @param aCoord the block coords.
+     */
+    void prefetch(const Point & aCoord) const
+    {
+      ASSERT(domainBlockCoords().isInside(aCoord));
+
+      Domain d = findSubDomainFromBlockCoords( aCoord );
+      if (!myImageCache->getPage(d) && !detail::prefetchImage(*myImageFactory, d, 0))
+        myImageCache->update(d);
+    }
+
+    /**
+     * Sets the number of tiles loaded in advance along the iteration
+     * direction by the iterators, each time they enter a new tile.
+     *
+     * @param aNbTiles the number of tiles (0, the default, to disable
+     * the prefetching).
+     */
+    void setPrefetch(unsigned int aNbTiles)
+    {
+      myPrefetch = aNbTiles;
+    }
+
+    /**
+     * @return the number of tiles loaded in advance by the iterators.
+     */
+    unsigned int getPrefetch() const
+    {
+      return myPrefetch;
+    }
+
     /**
      * Get the value of an image (from cache) at a given position given by aPoint.
      *
@@ -734,6 +857,23 @@ namespace DGtal
       return aValue;
     }
 
+    /**
+     * Get the value of an image (from cache) at a given position given
+     * by aPoint. May be called concurrently by several threads (only
+     * concurrentRead may be called meanwhile).
+     *
+     * @pre the read policy is sharded (see ImageCache::concurrentRead).
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value concurrentRead(const Point & aPoint) const
+    {
+      ASSERT(myImageFactory->domain().isInside(aPoint));
+
+      return myImageCache->concurrentRead(findSubDomain(aPoint), aPoint);
+    }
+
     /**
      * Set a value on an image (in cache) at a position specified by a aPoint.
      *
@@ -802,6 +942,9 @@ namespace DGtal
     /// TImageCacheWritePolicy pointer
     TImageCacheWritePolicy *myWritePolicy;
 
+    /// Number of tiles loaded in advance by the iterators
+    unsigned int myPrefetch;
+
     // ------------------------- Internals ------------------------------------
 
   }; // end of class TiledImage
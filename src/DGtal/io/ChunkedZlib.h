@@ -0,0 +1,152 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkedZlib.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ChunkedZlib.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChunkedZlib_RECURSES)
+#error Recursive header files inclusion detected in ChunkedZlib.h
+#else // defined(ChunkedZlib_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkedZlib_RECURSES
+
+#if !defined ChunkedZlib_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkedZlib_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstdio>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct ChunkedZlib
+  /**
+   * Description of struct 'ChunkedZlib' <p>
+   * \brief Aim: compression of a payload in independent zlib chunks,
+   * compressed and decompressed in parallel (with OpenMP).
+   *
+   * The payload is cut in chunks of chunkSize bytes (the last one
+   * being shorter), each chunk being compressed in its own zlib
+   * stream. The compressed payload is the index of the chunks (the
+   * number of compressed bytes of each chunk, as 64-bit little-endian
+   * integers) followed by the compressed chunks. It is the payload of
+   * the vol and longvol files of Version 4 (see
+   * VolWriter::exportChunkedVol and LongvolWriter::exportChunkedLongvol),
+   * whose header gives the chunk size in a "Chunk-Size" field.
+   */
+  struct ChunkedZlib
+  {
+    /// Default number of bytes of the chunks (4 MiB).
+    static const std::size_t defaultChunkSize = std::size_t( 1 ) << 22;
+
+    /**
+     * @param payloadSize the number of bytes of the payload.
+     * @param chunkSize the number of bytes of the chunks.
+     * @return the number of chunks of the payload.
+     */
+    static std::size_t nbChunks( std::size_t payloadSize, std::size_t chunkSize );
+
+    /**
+     * Compresses a payload by chunks and writes it.
+     *
+     * @param out the output stream.
+     * @param payload the payload.
+     * @param chunkSize the number of bytes of the chunks.
+     *
+     * @throw IOException if zlib fails.
+     */
+    static void write( std::ostream & out, const std::vector<char> & payload,
+                       std::size_t chunkSize );
+
+    /**
+     * Decodes and checks the index of the chunks of a payload.
+     *
+     * @param index the index of the chunks (8 bytes per chunk).
+     * @param payloadSize the number of uncompressed bytes.
+     * @param chunkSize the number of bytes of the chunks.
+     * @param available the number of bytes that follow the index.
+     * @return the offsets of the chunks after the index (nbChunks + 1
+     * values, the last one being the size of the compressed chunks).
+     *
+     * @throw IOException if a chunk is longer than the zlib bound of
+     * its uncompressed size, or if the chunks do not fit in @a
+     * available bytes.
+     */
+    static std::vector<std::size_t> decodeIndex( const std::vector<unsigned char> & index,
+                                                 std::size_t payloadSize,
+                                                 std::size_t chunkSize,
+                                                 std::size_t available );
+
+    /**
+     * Decompresses a chunk.
+     *
+     * @param chunk the compressed chunk.
+     * @param length the number of bytes of the compressed chunk.
+     * @param[out] out the uncompressed chunk.
+     * @param expected the number of uncompressed bytes of the chunk.
+     * @return 'true' if the chunk is valid and has @a expected bytes.
+     */
+    static bool uncompressChunk( const unsigned char * chunk, std::size_t length,
+                                 char * out, std::size_t expected );
+
+    /**
+     * Reads and decompresses a payload compressed by chunks.
+     *
+     * @param in the input file, positioned at the index of the chunks.
+     * @param[in,out] payload the payload, whose size must be the
+     * number of uncompressed bytes.
+     * @param chunkSize the number of bytes of the chunks.
+     *
+     * @throw IOException if the file is too short or corrupted (the
+     * index is checked by decodeIndex before any allocation).
+     */
+    static void read( FILE * in, std::vector<char> & payload,
+                      std::size_t chunkSize );
+
+  }; // end of struct ChunkedZlib
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/ChunkedZlib.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkedZlib_h
+
+#undef ChunkedZlib_RECURSES
+#endif // else defined(ChunkedZlib_RECURSES)
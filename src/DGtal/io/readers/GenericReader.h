@@ -49,6 +49,7 @@
 #include "DGtal/io/readers/PPMReader.h"
 #include "DGtal/io/readers/PGMReader.h"
 #include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/readers/MappedFileReader.h"
 #ifdef WITH_HDF5
 #include "DGtal/io/readers/HDF5Reader.h"
 #endif
@@ -92,6 +93,10 @@ namespace DGtal
    * "unsigned char" and if the TContainer::Value type is different, you
    * could have type conversion issues.
    *
+   * @advanced with a 3D ImageContainerByMappedFile, uncompressed vol,
+   * longvol and raw files are mapped in memory instead of being read
+   * (see MappedFileReader): TContainer::Value must then be the type of
+   * the file values.
    *
    * @tparam TContainer the container (mainly an ImageContainer like ImageContainerBySTLVector or ImageContainerBySTLMap).
    * @tparam Tdim the dimension of the container (by default given by the container).
@@ -394,6 +399,81 @@ namespace DGtal
   };
 
 
+  /**
+   * GenericReader
+   * Template partial specialisation for volume images mapped from
+   * raw, vol or longvol files (see MappedFileReader): the values are
+   * neither read nor copied.
+   **/
+  template <typename TDomain, typename TValue>
+  struct GenericReader<ImageContainerByMappedFile<TDomain, TValue>, 3, TValue>
+  {
+    typedef ImageContainerByMappedFile<TDomain, TValue> TContainer;
+    BOOST_CONCEPT_ASSERT((  concepts::CImage<TContainer> )) ;
+
+    /**
+     * Maps a volume image file (uncompressed vol or longvol, or raw
+     * file whose size is given by x, y and z) in read-only mode.
+     *
+     * @param filename the image filename to be imported.
+     * @param x the size in the x direction.
+     * @param y the size in the y direction.
+     * @param z the size in the z direction.
+     *
+     **/
+    static TContainer import(const std::string &filename,  unsigned int x=0,
+                             unsigned int y=0, unsigned int z=0);
+  };
+
+  /**
+   * GenericReader
+   * Template partial specialisation for volume images with 32 bits
+   * values mapped from raw files.
+   **/
+  template <typename TDomain>
+  struct GenericReader<ImageContainerByMappedFile<TDomain, DGtal::uint32_t>, 3, DGtal::uint32_t>
+  {
+    typedef ImageContainerByMappedFile<TDomain, DGtal::uint32_t> TContainer;
+    BOOST_CONCEPT_ASSERT((  concepts::CImage<TContainer> )) ;
+
+    /**
+     * Maps a raw volume image file in read-only mode.
+     *
+     * @param filename the image filename to be imported.
+     * @param x the size in the x direction.
+     * @param y the size in the y direction.
+     * @param z the size in the z direction.
+     *
+     **/
+    static TContainer import(const std::string &filename,  unsigned int x=0,
+                             unsigned int y=0, unsigned int z=0);
+  };
+
+  /**
+   * GenericReader
+   * Template partial specialisation for volume images with 64 bits
+   * values mapped from longvol or raw files.
+   **/
+  template <typename TDomain>
+  struct GenericReader<ImageContainerByMappedFile<TDomain, DGtal::uint64_t>, 3, DGtal::uint64_t>
+  {
+    typedef ImageContainerByMappedFile<TDomain, DGtal::uint64_t> TContainer;
+    BOOST_CONCEPT_ASSERT((  concepts::CImage<TContainer> )) ;
+
+    /**
+     * Maps an uncompressed longvol file, or a raw volume image file
+     * whose size is given by x, y and z, in read-only mode.
+     *
+     * @param filename the image filename to be imported.
+     * @param x the size in the x direction.
+     * @param y the size in the y direction.
+     * @param z the size in the z direction.
+     *
+     **/
+    static TContainer import(const std::string &filename,  unsigned int x=0,
+                             unsigned int y=0, unsigned int z=0);
+  };
+
   /**
    * GenericReader
    * Template partial specialisation for volume images of dimension 2
@@ -45,6 +45,7 @@
 #include <string>
 #include <cstdio>
 #include "DGtal/base/Common.h"
+#include "DGtal/io/ChunkedZlib.h"
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/CUnaryFunctor.h"
@@ -62,7 +63,10 @@ namespace DGtal
    * (with DGtal::uint64_t value type).
    *
    * The main import method "importLongvol" returns an instance of the template
-   * parameter TImageContainer.
+   * parameter TImageContainer. The payload may be raw (Version 2),
+   * compressed in a single zlib stream (Version 3) or compressed in
+   * independent chunks (Version 4, see LongvolWriter::exportChunkedLongvol), which are
+   * then decompressed in parallel.
    *
    * The private methods have been backported from the Simplelvol project
    * (see http://liris.cnrs.fr/david.coeurjolly).
@@ -136,7 +140,7 @@ namespace DGtal
       {
         fin.get( c ) ;
         unsigned char cc=static_cast<unsigned char>(c);
-        aValue |= (cc << (8 * size));
+        aValue |= ( Word( cc ) << ( 8 * size ) );
       }
       return fin;
     }
@@ -0,0 +1,186 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MappedFileReader.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module MappedFileReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MappedFileReader_RECURSES)
+#error Recursive header files inclusion detected in MappedFileReader.h
+#else // defined(MappedFileReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MappedFileReader_RECURSES
+
+#if !defined MappedFileReader_h
+/** Prevents repeated inclusion of headers. */
+#define MappedFileReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <cstddef>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MappedFileReader
+  /**
+   * Description of template class 'MappedFileReader' <p>
+   * \brief Aim: import of raw, vol and longvol files as
+   * ImageContainerByMappedFile, i.e. without reading nor copying their
+   * values.
+   *
+   * Contrary to RawReader, VolReader and LongvolReader, the values are
+   * not converted: the type of the image values must be the one of
+   * the file (e.g. unsigned char for vol files, DGtal::uint64_t for
+   * longvol files), and only uncompressed vol and longvol files
+   * (Version 2) can be mapped: the compressed ones (Version 3, or
+   * Version 4 whose payload is compressed in chunks) must be read by
+   * VolReader, LongvolReader or SliceStreamReader. The domain of a vol or longvol file is
+   * the one given by VolReader and LongvolReader.
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> Image;
+   * Image image = MappedFileReader<Image>::importVol( "data.vol" );
+   * // or
+   * Image image2 = GenericReader<Image>::import( "data.vol" );
+   * @endcode
+   *
+   * @tparam TImageContainer an ImageContainerByMappedFile.
+   *
+   * @see testMappedFileReader.cpp
+   */
+  template <typename TImageContainer>
+  struct MappedFileReader
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Domain::Point Point;
+    typedef typename TImageContainer::Domain::Vector Vector;
+
+    /**
+     * Maps a raw file (values of type Value stored in little-endian
+     * format).
+     *
+     * @param filename the file name to import.
+     * @param extent the size of the raw data set.
+     * @param writable when 'true', the file is mapped in read-write mode.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer importRaw( const std::string & filename,
+                                     const Vector & extent,
+                                     bool writable = false );
+
+    /**
+     * Maps an uncompressed vol file (Version 2).
+     * @pre Value is a 8-bit type.
+     *
+     * @param filename the file name to import.
+     * @param writable when 'true', the file is mapped in read-write mode.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer importVol( const std::string & filename,
+                                     bool writable = false );
+
+    /**
+     * Maps an uncompressed longvol file (Version 2).
+     * @pre Value is a 64-bit type.
+     *
+     * @param filename the file name to import.
+     * @param writable when 'true', the file is mapped in read-write mode.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer importLongvol( const std::string & filename,
+                                         bool writable = false );
+
+    /**
+     * Maps a raw, vol or longvol file according to its extension.
+     *
+     * @param filename the file name to import.
+     * @param extent the size of the data set (raw files only).
+     * @param writable when 'true', the file is mapped in read-write mode.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer import( const std::string & filename,
+                                  const Vector & extent = Vector::zero,
+                                  bool writable = false );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// 'true_type' for 3D images, the only ones stored in vol files.
+    typedef std::integral_constant<bool, Domain::dimension == 3> IsVolDimension;
+
+    /**
+     * Maps a vol or longvol file: reads its header and checks that it
+     * is uncompressed.
+     *
+     * @param filename the file name.
+     * @param sizeOfValue the number of bytes of the values of the file.
+     * @param writable when 'true', the file is mapped in read-write mode.
+     * @return an instance of the ImageContainer.
+     *
+     * @throw IOException if the header is invalid, if the file is
+     * compressed or if its values are not of the size of Value.
+     */
+    static ImageContainer importVolFile( const std::string & filename,
+                                         std::size_t sizeOfValue,
+                                         bool writable, std::true_type );
+
+    /**
+     * Vol files are 3D files.
+     * @throw IOException
+     */
+    static ImageContainer importVolFile( const std::string & filename,
+                                         std::size_t sizeOfValue,
+                                         bool writable, std::false_type );
+
+  }; // end of class MappedFileReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/MappedFileReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MappedFileReader_h
+
+#undef MappedFileReader_RECURSES
+#endif // else defined(MappedFileReader_RECURSES)
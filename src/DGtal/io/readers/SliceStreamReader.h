@@ -0,0 +1,337 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SliceStreamReader.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SliceStreamReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SliceStreamReader_RECURSES)
+#error Recursive header files inclusion detected in SliceStreamReader.h
+#else // defined(SliceStreamReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SliceStreamReader_RECURSES
+
+#if !defined SliceStreamReader_h
+/** Prevents repeated inclusion of headers. */
+#define SliceStreamReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/concepts.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/io/ChunkedZlib.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SliceStreamReader
+  /**
+   * Description of template class 'SliceStreamReader' <p>
+   * \brief Aim: import of a 3D image file one slab of z-slices at a
+   * time, so that an image larger than the memory can be processed
+   * with a bounded memory.
+   *
+   * The file is opened and its header read by the constructor, which
+   * gives the domain of the whole image (the one given by VolReader,
+   * LongvolReader, RawReader or PGMReader). Then each call to
+   * readSlab(k) returns an image whose domain holds the next k slices
+   * (fewer for the last slab), the values being converted with the
+   * functor as in the other readers. The supported formats, chosen
+   * by the extension of the file, are:
+   * - vol and longvol, compressed (Version 3, decompressed on the fly),
+   *   compressed in chunks (Version 4, see ChunkedZlib, decompressed
+   *   one chunk at a time) or not (Version 2);
+   * - raw, of unsigned values of 1, 2, 4 or 8 bytes in little-endian
+   *   format, whose extent is given to the constructor;
+   * - pgm3d (pgm3D, p3d, pgm), in binary (P5) or ASCII (P2) mode.
+   *
+   * Used with SliceStreamWriter, slab pipelines may be written:
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * SliceStreamReader<Image> reader( "input.vol" );
+   * SliceStreamWriter<Image> writer( "output.vol", reader.domain() );
+   * while ( reader.hasNextSlab() )
+   *   {
+   *     Image slab = reader.readSlab( 16 );
+   *     for ( auto const& p : slab.domain() )
+   *       slab.setValue( p, slab( p ) > 128 ? 255 : 0 );
+   *     writer.writeSlab( slab );
+   *   }
+   * writer.close();
+   * @endcode
+   *
+   * @tparam TImageContainer the 3D image container of the slabs.
+   * @tparam TFunctor the type of functor used in the import (by
+   * default set to functors::Cast< TImageContainer::Value>).
+   *
+   * @see SliceStreamWriter
+   * @see testSliceStreamReader.cpp
+   */
+  template <typename TImageContainer,
+            typename TFunctor = functors::Cast< typename TImageContainer::Value > >
+  class SliceStreamReader
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_STATIC_ASSERT(( TImageContainer::Domain::dimension == 3 ));
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Domain::Point Point;
+    typedef typename TImageContainer::Domain::Vector Vector;
+    typedef typename TImageContainer::Domain::Integer Integer;
+    typedef TFunctor Functor;
+
+    /// The supported file formats.
+    enum Format { VOL, LONGVOL, RAW, PGM3D };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Opens the file and reads its header.
+     *
+     * @param filename the file name to import.
+     * @param rawExtent the size of the data set (raw files only).
+     * @param rawWordSize the number of bytes of the values (raw files only).
+     * @param aFunctor the functor used to cast the file values into
+     * the type of the image container value.
+     *
+     * @throw IOException if the file cannot be opened or if its header
+     * is invalid.
+     */
+    SliceStreamReader( const std::string & filename,
+                       const Vector & rawExtent = Vector::zero,
+                       unsigned int rawWordSize = 1,
+                       const Functor & aFunctor = Functor() );
+
+    /**
+     * Destructor. Closes the file.
+     */
+    ~SliceStreamReader() = default;
+
+  private:
+
+    SliceStreamReader( const SliceStreamReader & other );
+
+    SliceStreamReader & operator=( const SliceStreamReader & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the whole image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the format of the file.
+     */
+    Format format() const;
+
+    /**
+     * @return the z coordinate of the next slice to be read.
+     */
+    Integer nextSlice() const;
+
+    /**
+     * @return 'true' if some slices are not read yet.
+     */
+    bool hasNextSlab() const;
+
+    /**
+     * Reads the next slices.
+     * @pre hasNextSlab()
+     *
+     * @param k the number of slices to read.
+     * @return an image whose domain holds the next k slices (or the
+     * remaining ones, if fewer).
+     *
+     * @throw IOException if the file is too short.
+     */
+    ImageContainer readSlab( unsigned int k = 1 );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Types --------------------------------
+  private:
+
+    /**
+     * Source of the payload of a Version 4 vol or longvol file, which
+     * decompresses the chunks one at a time as they are read.
+     */
+    class ChunkedZlibSource
+    {
+    public:
+      typedef char char_type;
+      typedef boost::iostreams::source_tag category;
+
+      /**
+       * Constructor. Reads and checks the index of the chunks.
+       *
+       * @param in the input file, positioned at the index of the chunks.
+       * @param payloadSize the number of uncompressed bytes.
+       * @param chunkSize the number of bytes of the chunks.
+       *
+       * @throw IOException if the index is invalid.
+       */
+      ChunkedZlibSource( std::istream & in, std::size_t payloadSize, std::size_t chunkSize );
+
+      /**
+       * Reads at most @a n uncompressed bytes.
+       * @return the number of bytes read, or -1 at the end of the payload.
+       */
+      std::streamsize read( char * s, std::streamsize n );
+
+    private:
+      /// The input file
+      std::istream * myIn;
+      /// The number of uncompressed bytes
+      std::size_t myPayloadSize;
+      /// The number of bytes of the chunks
+      std::size_t myChunkSize;
+      /// The offsets of the compressed chunks
+      std::vector<std::size_t> myOffsets;
+      /// The index of the next chunk to decompress
+      std::size_t myNextChunk;
+      /// The current compressed chunk
+      std::vector<unsigned char> myCompressed;
+      /// The current uncompressed chunk
+      std::vector<char> myChunk;
+      /// The number of bytes of the current chunk already read
+      std::size_t myPosition;
+    };
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The file name
+    std::string myFilename;
+
+    /// The format of the file
+    Format myFormat;
+
+    /// Domain of the whole image
+    Domain myDomain;
+
+    /// Number of bytes of the values
+    unsigned int myWordSize;
+
+    /// 'true' for ASCII pgm files
+    bool myASCII;
+
+    /// The functor casting the file values
+    Functor myFunctor;
+
+    /// The z coordinate of the next slice
+    Integer myNextSlice;
+
+    /// The file
+    std::ifstream myFile;
+
+    /// The payload, decompressed if needed
+    boost::iostreams::filtering_istream myStream;
+
+    /// The bytes of a slice
+    std::vector<char> myBuffer;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Reads the header of a vol or longvol file and sets the domain.
+     * @param[out] chunkSize the number of bytes of the chunks of a
+     * Version 4 file.
+     * @return the version of the file.
+     */
+    int readVolHeader( std::size_t & chunkSize );
+
+    /**
+     * Reads the header of a pgm file and sets the domain.
+     */
+    void readPGMHeader();
+
+    /**
+     * Reads the slice @a z into @a aSlab.
+     * @tparam Word the type of the file values.
+     * @param bigEndian 'true' if the values are stored in big-endian format.
+     */
+    template <typename Word>
+    void readSlice( ImageContainer & aSlab, Integer z, bool bigEndian );
+
+    /**
+     * Reads the slice @a z of an ASCII file into @a aSlab.
+     */
+    void readASCIISlice( ImageContainer & aSlab, Integer z );
+
+  }; // end of class SliceStreamReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SliceStreamReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SliceStreamReader' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out, const SliceStreamReader<TImageContainer, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/SliceStreamReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SliceStreamReader_h
+
+#undef SliceStreamReader_RECURSES
+#endif // else defined(SliceStreamReader_RECURSES)
@@ -0,0 +1,156 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VolHeader.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module VolHeader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VolHeader_RECURSES)
+#error Recursive header files inclusion detected in VolHeader.h
+#else // defined(VolHeader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VolHeader_RECURSES
+
+#if !defined VolHeader_h
+/** Prevents repeated inclusion of headers. */
+#define VolHeader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class VolHeader
+  /**
+   * Description of class 'VolHeader' <p>
+   * \brief Aim: the header of a vol or longvol file, read from a
+   * stream by the readers that do not load the whole file
+   * (MappedFileReader, SliceStreamReader).
+   *
+   * The header is made of "Key: value" lines ended by a "." line, as
+   * read by VolReader and LongvolReader. The fields X, Y, Z and
+   * Version are required, Center-X, Center-Y and Center-Z give the
+   * center of the domain and Chunk-Size the number of bytes of the
+   * chunks of a Version 4 payload (see ChunkedZlib).
+   *
+   * @code
+   * std::ifstream in( "image.vol", std::ios::in | std::ios::binary );
+   * VolHeader header( in, "MyReader", "image.vol" );
+   * header.checkVersion( { 2, 3 } );
+   * Z3i::Domain domain = header.domain<Z3i::Domain>();
+   * @endcode
+   */
+  class VolHeader
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Reads the header and checks its required fields.
+     * The stream is then positioned at the payload.
+     *
+     * @param in the input stream, positioned at the beginning of the file.
+     * @param aReaderName the name of the reader, used in the error messages.
+     * @param filename the file name, used in the error messages.
+     *
+     * @throw IOException if a line is not a "Key: value" line, or if
+     * the "." line or a required field is missing.
+     */
+    VolHeader( std::istream & in, const std::string & aReaderName,
+               const std::string & filename );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param key a field name.
+     * @return 'true' if the header has the field @a key.
+     */
+    bool has( const std::string & key ) const;
+
+    /**
+     * @param key a field name.
+     * @return the value of the field @a key as an integer (0 if
+     * missing or invalid).
+     */
+    int asInt( const std::string & key ) const;
+
+    /**
+     * @return the version of the file.
+     */
+    int version() const;
+
+    /**
+     * Checks that the version of the file is one of @a versions.
+     * @param versions the versions supported by the reader.
+     *
+     * @throw IOException otherwise.
+     */
+    void checkVersion( const std::vector<int> & versions ) const;
+
+    /**
+     * @tparam TDomain a 3D domain type.
+     * @return the domain given by the X, Y, Z (and Center-X, Center-Y,
+     * Center-Z) fields, as computed by VolReader.
+     */
+    template <typename TDomain>
+    TDomain domain() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The fields of the header
+    std::map<std::string, std::string> myFields;
+
+    /// The reader name, for the error messages
+    std::string myReaderName;
+
+    /// The file name, for the error messages
+    std::string myFilename;
+
+  }; // end of class VolHeader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/VolHeader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VolHeader_h
+
+#undef VolHeader_RECURSES
+#endif // else defined(VolHeader_RECURSES)
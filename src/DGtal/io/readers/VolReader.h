@@ -45,6 +45,7 @@
 #include <string>
 #include <cstdio>
 #include "DGtal/base/Common.h"
+#include "DGtal/io/ChunkedZlib.h"
 #include "DGtal/base/CUnaryFunctor.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -58,7 +59,10 @@ namespace DGtal
    * \brief Aim: implements methods to read a "Vol" file format.
    *
    * The main import method "importVol" returns an instance of the template 
-   * parameter TImageContainer.
+   * parameter TImageContainer. The payload may be raw (Version 2),
+   * compressed in a single zlib stream (Version 3) or compressed in
+   * independent chunks (Version 4, see VolWriter::exportChunkedVol), which are
+   * then decompressed in parallel.
    *
    * The private methods have been backported from the SimpleVol project 
    * (see http://liris.cnrs.fr/david.coeurjolly).
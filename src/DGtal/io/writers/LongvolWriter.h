@@ -45,6 +45,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/ChunkedZlib.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -91,26 +92,39 @@ namespace DGtal
     static bool exportLongvol(const std::string & filename, const Image &aImage,
                               const bool compressed = true,
                               const Functor & aFunctor = Functor());
+
+    /** 
+     * Export an Image with the Longvol format of Version 4, whose
+     * payload is compressed in independent chunks in parallel (see
+     * ChunkedZlib). LongvolReader decompresses them in parallel too.
+     * 
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param chunkSize number of (uncompressed) bytes of the chunks
+     * @param aFunctor functor used to cast image values
+     * @return true if no errors occur.
+     */
+    static bool exportChunkedLongvol(const std::string & filename, const Image &aImage,
+                                     const std::size_t chunkSize = ChunkedZlib::defaultChunkSize,
+                                     const Functor & aFunctor = Functor());
     
     
   private: 
     
     /** 
-     * Generic write word (binary mode) in little-endian.
-     * 
-     * @param outs output stream.
-     * @param value value to write.
+     * Export an Image with the Longvol format of the given version: 2
+     * (uncompressed), 3 (compressed) or 4 (compressed in chunks).
      * 
-     * @return modified stream.
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param version the version of the file
+     * @param chunkSize number of (uncompressed) bytes of the chunks (Version 4 only)
+     * @param aFunctor functor used to cast image values
+     * @return true if no errors occur.
      */
-    template <typename Word>
-    static
-    std::ostream& write_word( std::ostream& outs, Word value )
-    {
-      for (unsigned size = sizeof( Word ); size; --size, value >>= 8)
-        outs.put( static_cast <char> (value & 0xFF) );
-      return outs;
-    }
+    static bool exportLongvolFile(const std::string & filename, const Image &aImage,
+                                  const int version, const std::size_t chunkSize,
+                                  const Functor & aFunctor);
     
   };
 }//namespace
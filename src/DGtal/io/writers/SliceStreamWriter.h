@@ -0,0 +1,236 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SliceStreamWriter.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SliceStreamWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SliceStreamWriter_RECURSES)
+#error Recursive header files inclusion detected in SliceStreamWriter.h
+#else // defined(SliceStreamWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SliceStreamWriter_RECURSES
+
+#if !defined SliceStreamWriter_h
+/** Prevents repeated inclusion of headers. */
+#define SliceStreamWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <boost/iostreams/filtering_stream.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/CConstImage.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SliceStreamWriter
+  /**
+   * Description of template class 'SliceStreamWriter' <p>
+   * \brief Aim: export of a 3D image one slab of z-slices at a time,
+   * so that an image larger than the memory can be written with a
+   * bounded memory.
+   *
+   * The header of the file is written by the constructor from the
+   * domain of the whole image. Then the slabs (images holding whole
+   * z-slices of this domain, e.g. given by SliceStreamReader::readSlab)
+   * are written in increasing z order by writeSlab(), the values being
+   * cast to the values of the format after the functor. close() ends
+   * the file, which must then hold all the slices. The formats, chosen
+   * by the extension of the file, are the ones of VolWriter (unsigned
+   * char values), LongvolWriter (DGtal::uint64_t values), RawWriter
+   * (unsigned values of 1, 2, 4 or 8 bytes) and PGMWriter::exportPGM3D
+   * (binary mode).
+   *
+   * @tparam TImageContainer the 3D image container of the slabs.
+   * @tparam TFunctor the type of functor used in the export (by
+   * default set to functors::Identity).
+   *
+   * @see SliceStreamReader
+   * @see testSliceStreamReader.cpp
+   */
+  template <typename TImageContainer, typename TFunctor = functors::Identity >
+  class SliceStreamWriter
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CConstImage<TImageContainer> ));
+    BOOST_STATIC_ASSERT(( TImageContainer::Domain::dimension == 3 ));
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Domain::Point Point;
+    typedef typename TImageContainer::Domain::Vector Vector;
+    typedef typename TImageContainer::Domain::Integer Integer;
+    typedef TFunctor Functor;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Creates the file and writes its header.
+     *
+     * @param filename the file name to export.
+     * @param aDomain the domain of the whole image.
+     * @param compressed when 'true', vol and longvol files are
+     * compressed (Version 3) on the fly.
+     * @param rawWordSize the number of bytes of the values (raw files only).
+     * @param aFunctor the functor applied to the image values.
+     *
+     * @throw IOException if the file cannot be created.
+     */
+    SliceStreamWriter( const std::string & filename,
+                       const Domain & aDomain,
+                       bool compressed = false,
+                       unsigned int rawWordSize = 1,
+                       const Functor & aFunctor = Functor() );
+
+    /**
+     * Destructor. Closes the file, complete or not.
+     */
+    ~SliceStreamWriter();
+
+  private:
+
+    SliceStreamWriter( const SliceStreamWriter & other );
+
+    SliceStreamWriter & operator=( const SliceStreamWriter & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the whole image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the z coordinate of the next slice to be written.
+     */
+    Integer nextSlice() const;
+
+    /**
+     * Writes the slices of a slab.
+     * @pre the x and y bounds of the slab domain are the ones of
+     * domain(), and its first slice is nextSlice().
+     *
+     * @param aSlab an image holding whole slices.
+     *
+     * @throw IOException if the slab does not follow the written slices.
+     */
+    void writeSlab( const ImageContainer & aSlab );
+
+    /**
+     * Ends the file (flushing the compressed stream).
+     *
+     * @throw IOException if some slices are not written.
+     */
+    void close();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The file name
+    std::string myFilename;
+
+    /// Domain of the whole image
+    Domain myDomain;
+
+    /// Number of bytes of the values
+    unsigned int myWordSize;
+
+    /// The functor applied to the image values
+    Functor myFunctor;
+
+    /// The z coordinate of the next slice
+    Integer myNextSlice;
+
+    /// The file
+    std::ofstream myFile;
+
+    /// The payload, compressed if needed
+    boost::iostreams::filtering_ostream myStream;
+
+    /// The bytes of a slice
+    std::vector<char> myBuffer;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Writes the slice @a z of @a aSlab.
+     * @tparam Word the type of the file values.
+     */
+    template <typename Word>
+    void writeSlice( const ImageContainer & aSlab, Integer z );
+
+  }; // end of class SliceStreamWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SliceStreamWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SliceStreamWriter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out, const SliceStreamWriter<TImageContainer, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/SliceStreamWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SliceStreamWriter_h
+
+#undef SliceStreamWriter_RECURSES
+#endif // else defined(SliceStreamWriter_RECURSES)
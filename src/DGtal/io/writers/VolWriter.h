@@ -47,6 +47,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/ChunkedZlib.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -87,6 +88,38 @@ namespace DGtal
     static bool exportVol(const std::string & filename, const Image &aImage, 
                           const bool compressed=true,
                           const Functor & aFunctor = Functor());
+
+    /** 
+     * Export an Image with the Vol format of Version 4, whose payload
+     * is compressed in independent chunks in parallel (see
+     * ChunkedZlib). VolReader decompresses them in parallel too.
+     * 
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param chunkSize number of (uncompressed) bytes of the chunks
+     * @param aFunctor functor used to cast image values
+     * @return true if no errors occur.
+     */
+    static bool exportChunkedVol(const std::string & filename, const Image &aImage,
+                                 const std::size_t chunkSize = ChunkedZlib::defaultChunkSize,
+                                 const Functor & aFunctor = Functor());
+
+  private:
+
+    /** 
+     * Export an Image with the Vol format of the given version: 2
+     * (uncompressed), 3 (compressed) or 4 (compressed in chunks).
+     * 
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param version the version of the file
+     * @param chunkSize number of (uncompressed) bytes of the chunks (Version 4 only)
+     * @param aFunctor functor used to cast image values
+     * @return true if no errors occur.
+     */
+    static bool exportVolFile(const std::string & filename, const Image &aImage,
+                              const int version, const std::size_t chunkSize,
+                              const Functor & aFunctor);
   };
 }//namespace
 
@@ -0,0 +1,512 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByRunLength.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DigitalSetByRunLength.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testDigitalSetByRunLength.cpp
+ */
+
+#if defined(DigitalSetByRunLength_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByRunLength.h
+#else // defined(DigitalSetByRunLength_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByRunLength_RECURSES
+
+#if !defined DigitalSetByRunLength_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByRunLength_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByRunLength
+  /**
+    Description of template class 'DigitalSetByRunLength' <p> \brief
+    Aim: Realizes the concept CDigitalSet by storing, for each row of
+    the domain along the first axis (i.e. for each value of the other
+    coordinates), the sorted list of its maximal runs [first,last] of
+    points.
+
+    Membership test, insertion and removal of a point are binary
+    searches in its row. Points are visited in the order of the
+    domain (first axis first). Union, intersection and difference of
+    sets, and the neighbors of a point (in the metric adjacency of
+    norm-1 bounded by 1 to n, i.e. 6/18/26 in 3D), are computed
+    directly on runs.
+
+    A run takes two coordinates and each row a std::vector (24 bytes),
+    hence the set uses less than one bit per point of the domain as
+    soon as rows are longer than 200 points or so and hold few runs
+    (e.g. the volumes of big and smooth or sparse shapes). Its memory
+    usage is given by memoryUsage().
+
+    @code
+    typedef DigitalSetByRunLength<Z3i::Domain> RLSet;
+    RLSet set( domain );
+    Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 0, 0, 0 ), 50 );
+    std::cout << set.nbRuns() << " runs, " << set.memoryUsage() << "B" << std::endl;
+    std::vector<Z3i::Point> N;
+    std::back_insert_iterator< std::vector<Z3i::Point> > out = std::back_inserter( N );
+    set.writeNeighbors( out, Z3i::Point( 50, 0, 0 ), 1 ); // 6-neighbors in set
+    @endcode
+
+    @tparam TDomain a realization of the concept CDomain with
+    lowerBound() and upperBound() (e.g. an HyperRectDomain).
+
+    @see CDigitalSet, DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByRunLength
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByRunLength<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+    static const Dimension dimension = Space::dimension;
+
+    /// A maximal run of points [first,last] along the first axis.
+    struct Run
+    {
+      Coordinate first; ///< the first coordinate of the run.
+      Coordinate last;  ///< the last coordinate of the run (included).
+      bool operator==( const Run & other ) const
+      { return first == other.first && last == other.last; }
+    };
+    /// The sorted runs of a row.
+    typedef std::vector<Run> RunRange;
+
+    /// Constant forward iterator on the points of the set, in the
+    /// order of the domain.
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, const Point,
+                                       boost::forward_traversal_tag >
+    {
+    public:
+      /// Default constructor (invalid iterator).
+      ConstIterator() : mySet( 0 ), myRow( 0 ), myRun( 0 ) {}
+      /**
+         Constructor.
+         @param set the visited set.
+         @param row the index of the current row.
+         @param run the index of the current run in the row.
+         @param p the current point.
+      */
+      ConstIterator( const Self* set, Size row, Size run, const Point & p )
+        : mySet( set ), myRow( row ), myRun( run ), myPoint( p ) {}
+    private:
+      friend class boost::iterator_core_access;
+      void increment();
+      bool equal( const ConstIterator & other ) const
+      { return myRow == other.myRow && myRun == other.myRun
+          && myPoint[ 0 ] == other.myPoint[ 0 ]; }
+      const Point & dereference() const
+      { return myPoint; }
+
+      const Self* mySet; ///< the visited set.
+      Size myRow;        ///< the index of the current row.
+      Size myRun;        ///< the index of the current run in the row.
+      Point myPoint;     ///< the current point.
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByRunLength() = default;
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByRunLength( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByRunLength ( const DigitalSetByRunLength & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRunLength & operator= ( const DigitalSetByRunLength & other ) = default;
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set (same as insert).
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set (same as insert).
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Set union to left, computed row by row on runs.
+     * @param aSet any other set with the same domain.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRunLength<Domain> & operator+=
+    ( const DigitalSetByRunLength<Domain> & aSet );
+
+    /**
+     * Set intersection to left, computed row by row on runs.
+     * @param aSet any other set with the same domain.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRunLength<Domain> & operator&=
+    ( const DigitalSetByRunLength<Domain> & aSet );
+
+    /**
+     * Set difference to left, computed row by row on runs.
+     * @param aSet any other set with the same domain.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRunLength<Domain> & operator-=
+    ( const DigitalSetByRunLength<Domain> & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Run services -----------------------------
+  public:
+
+    /**
+     * @return the number of rows of the domain (points with the
+     * same coordinates except the first one).
+     */
+    Size nbRows() const;
+
+    /**
+     * @return the number of runs of the set.
+     */
+    Size nbRuns() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the sorted runs of the row containing @a p.
+     */
+    const RunRange & row( const Point & p ) const;
+
+    /**
+     * @return the number of bytes used by the set.
+     */
+    std::size_t memoryUsage() const;
+
+    /**
+     * Writes the neighbors of @a p that belong to this set, in the
+     * metric adjacency where points are adjacent if their coordinates
+     * differ by at most 1 and at most @a maxNorm1 of them differ
+     * (4/8-adjacency for 1/2 in 2D, 6/18/26-adjacency for 1/2/3 in
+     * 3D, see MetricAdjacency). Only the runs of the rows adjacent to
+     * @a p are visited.
+     *
+     * @tparam OutputIterator any output iterator on Point.
+     * @param out_it any output iterator for writing the neighbors.
+     * @param p any point (not necessarily in this set).
+     * @param maxNorm1 the maximal number of differing coordinates.
+     */
+    template <typename OutputIterator>
+    void writeNeighbors( OutputIterator & out_it, const Point & p,
+                         Dimension maxNorm1 ) const;
+
+    /**
+     * @param p any point (not necessarily in this set).
+     * @param maxNorm1 the maximal number of differing coordinates.
+     * @return the number of neighbors of @a p in this set (see writeNeighbors).
+     */
+    Size countNeighbors( const Point & p, Dimension maxNorm1 ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this, row by row on runs.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByRunLength<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // --------------- CDrawableWithBoard2D realization --------------------
+  public:
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The lowest point of the domain.
+    Point myLower;
+    /// The highest point of the domain.
+    Point myUpper;
+    /// The stride of each coordinate in the row index (0 for the first one).
+    std::vector<Size> myStrides;
+    /// The sorted runs of each row.
+    std::vector<RunRange> myRows;
+    /// The number of points of the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByRunLength();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Set operations performed by combine and combineRows.
+    enum class Operation { Union, Intersection, Difference };
+
+    /// @param p any point of the domain.
+    /// @return the index of its row.
+    Size rowIndex( const Point & p ) const;
+
+    /// @param r any row index.
+    /// @param x any first coordinate.
+    /// @return the point of row @a r with first coordinate @a x.
+    Point rowPoint( Size r, Coordinate x ) const;
+
+    /// @param r any row index.
+    /// @return the iterator on the first point of the first non-empty
+    /// row after or at @a r, or end().
+    ConstIterator firstPointFrom( Size r ) const;
+
+    /// @param runs any sorted runs.
+    /// @return the number of points of the runs.
+    static Size count( const RunRange & runs );
+
+    /// Computes the union, intersection or difference of two rows.
+    /// @param a any sorted runs.
+    /// @param b any sorted runs.
+    /// @param op the set operation.
+    /// @return the sorted runs of the result.
+    static RunRange combine( const RunRange & a, const RunRange & b, Operation op );
+
+    /// Replaces each row by its combination with the same row of @a aSet.
+    /// @param aSet any other set with the same domain.
+    /// @param op the set operation.
+    void combineRows( const DigitalSetByRunLength<Domain> & aSet, Operation op );
+
+  }; // end of class DigitalSetByRunLength
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByRunLength'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByRunLength' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByRunLength<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByRunLength.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByRunLength_h
+
+#undef DigitalSetByRunLength_RECURSES
+#endif // else defined(DigitalSetByRunLength_RECURSES)
@@ -48,9 +48,11 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByRunLength.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 #include <unordered_set>
+#include <type_traits>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -61,6 +63,7 @@ namespace DGtal
   enum DigitalSetVariability { LOW_VAR_DS = 0, HIGH_VAR_DS = 4 };
   enum DigitalSetIterability { LOW_ITER_DS = 0, HIGH_ITER_DS = 8 };
   enum DigitalSetBelongTestability { LOW_BEL_DS = 0, HIGH_BEL_DS = 16 };
+  enum DigitalSetRunLength { LOW_RUN_DS = 0, HIGH_RUN_DS = 32 };
 
   /////////////////////////////////////////////////////////////////////////////
   // template class DigitalSetSelector
@@ -83,6 +86,10 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * The hint HIGH_RUN_DS specifies that the points of the set form
+   * long runs along the first axis (e.g. big or smooth volumes) and
+   * selects a DigitalSetByRunLength.
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
@@ -91,7 +98,10 @@ namespace DGtal
     /**
      * Adequate digital set representation for the given preferences.
      */
-    typedef DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> > Type;
+    typedef typename std::conditional
+    < ( Preferences & HIGH_RUN_DS ) != 0,
+      DigitalSetByRunLength<Domain>,
+      DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> > >::type Type;
   }; // end of class DigitalSetSelector
 
 
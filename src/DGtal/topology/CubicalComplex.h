@@ -164,8 +164,10 @@ namespace DGtal
   *
   * @tparam TCellContainer any model of associative container, mapping
   * a KSpace::Cell to a CubicalCellData or any type deriving from
-  * it. It could be for instance a std::map or a
-  * std::unordered_map. Note that unfortunately, unordered_map are
+  * it. It could be for instance a std::map, a std::unordered_map
+  * or, faster and smaller, the FlatHashMap given by
+  * FlatHashCellContainers<KSpace>::CellMap<CubicalCellData>::Type
+  * (see KhalimskyCellContainers.h). Note that unfortunately, unordered_map are
   * (strangely) not models of boost::AssociativeContainer, hence we
   * cannot check concepts here.
   *
@@ -42,6 +42,9 @@
 // Inclusions
 #include <iostream>
 #include <array>
+#include <map>
+#include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -225,36 +228,23 @@ namespace DGtal
      * @param[in] triangles the vector of input oriented triangles.
      *
      * @param[out] edges_out the vector of all the unoriented edges of
-     * the given triangles.
+     * the given triangles, sorted in lexicographic order.
+     *
+     * @param[in] parallel when 'true', edges are sorted in parallel
+     * (with OpenMP). The output does not depend on it.
      *
      * @return the total number of different vertices (note that the
      * vertex numbering should be between 0 and this number minus
      * one).
      */
     static Size getUnorderedEdgesFromTriangles
-    ( const std::vector<Triangle>& triangles, std::vector< Edge >& edges_out )
+    ( const std::vector<Triangle>& triangles, std::vector< Edge >& edges_out,
+      bool parallel = false )
     {
-      typedef std::set< Edge > EdgeSet;
-      typedef std::set< VertexIndex > VertexIndexSet;
-      VertexIndexSet vertexSet;
-      EdgeSet edgeSet;
-      for( const Triangle& T : triangles )
-        {
-          edgeSet.insert( Edge( T.i(), T.j() ) );
-          edgeSet.insert( Edge( T.j(), T.k() ) );
-          edgeSet.insert( Edge( T.k(), T.i() ) );
-          vertexSet.insert( T.i() );
-          vertexSet.insert( T.j() );
-          vertexSet.insert( T.k() );
-        }
-      edges_out.resize( edgeSet.size() );
-      Size e = 0;
-      for ( const Edge& edge : edgeSet )
-        {
-          edges_out.at(e) = edge;
-          ++e;
-        }
-      return vertexSet.size();
+      std::vector< Index >       offsets;
+      std::vector< VertexIndex > vertices;
+      flattenFaces( triangles, offsets, vertices );
+      return getUnorderedEdgesFromFaces( offsets, vertices, edges_out, parallel );
     }
 
     /** 
@@ -266,14 +256,18 @@ namespace DGtal
      * @param[in] polygonal_faces the vector of input oriented polygonal faces.
      *
      * @param[out] edges_out the vector of all the unoriented edges of
-     * the given triangles.
+     * the given triangles, sorted in lexicographic order.
+     *
+     * @param[in] parallel when 'true', edges are sorted in parallel
+     * (with OpenMP). The output does not depend on it.
      *
      * @return the total number of different vertices (note that the
      * vertex numbering should be between 0 and this number minus
      * one).
      */
     static Size getUnorderedEdgesFromPolygonalFaces
-    ( const std::vector<PolygonalFace>& polygonal_faces, std::vector< Edge >& edges_out );
+    ( const std::vector<PolygonalFace>& polygonal_faces, std::vector< Edge >& edges_out,
+      bool parallel = false );
     
     /**
      * Builds the half-edge data structures from the given triangles
@@ -293,13 +287,17 @@ namespace DGtal
      * @param[in] triangles the vector of input triangles.
      * @param[in] edges the vector of input unoriented edges.
      *
+     * @param[in] parallel when 'true', arcs are sorted in parallel
+     * (with OpenMP). The output does not depend on it.
+     *
      * @return 'true' if everything went well, 'false' if their was
      * error in the given topology (for instance, three triangles
      * sharing an edge).
      */
     bool build( const Size num_vertices, 
                 const std::vector<Triangle>& triangles,
-                const std::vector<Edge>&     edges );
+                const std::vector<Edge>&     edges,
+                bool parallel = false );
 
     /**
      * Builds the half-edge data structures from the given polygonal faces
@@ -319,13 +317,17 @@ namespace DGtal
      * @param[in] polygonal_faces the vector of input polygonal_faces.
      * @param[in] edges the vector of input unoriented edges.
      *
+     * @param[in] parallel when 'true', arcs are sorted in parallel
+     * (with OpenMP). The output does not depend on it.
+     *
      * @return 'true' if everything went well, 'false' if their was
      * error in the given topology (for instance, three triangles
      * sharing an edge).
      */
     bool build( const Size                        num_vertices, 
                 const std::vector<PolygonalFace>& polygonal_faces,
-                const std::vector<Edge>&          edges );
+                const std::vector<Edge>&          edges,
+                bool parallel = false );
 
     /**
      * Builds the half-edge data structure from the given triangles.
@@ -334,12 +336,14 @@ namespace DGtal
      * \a triangles.
      *
      * @param[in] triangles the vector of input triangles.
+     * @param[in] parallel when 'true', edges and arcs are sorted in
+     * parallel (with OpenMP). The output does not depend on it.
      */
-    bool build( const std::vector<Triangle>& triangles )
+    bool build( const std::vector<Triangle>& triangles, bool parallel = false )
     {
       std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromTriangles( triangles, edges );
-      return build( nbVtx, triangles, edges );
+      const Size nbVtx = getUnorderedEdgesFromTriangles( triangles, edges, parallel );
+      return build( nbVtx, triangles, edges, parallel );
     }
 
     /**
@@ -349,12 +353,14 @@ namespace DGtal
      * \a polygonal_faces.
      *
      * @param[in] polygonal_faces the vector of input polygonal faces.
+     * @param[in] parallel when 'true', edges and arcs are sorted in
+     * parallel (with OpenMP). The output does not depend on it.
      */
-    bool build( const std::vector<PolygonalFace>& polygonal_faces )
+    bool build( const std::vector<PolygonalFace>& polygonal_faces, bool parallel = false )
     {
       std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromPolygonalFaces( polygonal_faces, edges );
-      return build( nbVtx, polygonal_faces, edges );
+      const Size nbVtx = getUnorderedEdgesFromPolygonalFaces( polygonal_faces, edges, parallel );
+      return build( nbVtx, polygonal_faces, edges, parallel );
     }
 
     /// Clears the data structure.
@@ -1421,6 +1427,69 @@ namespace DGtal
         }
       return it->second;
     }
+
+    /**
+     * Flattens the given triangles: the vertices of face f are
+     * vertices[ offsets[ f ] ], ..., vertices[ offsets[ f + 1 ] - 1 ].
+     *
+     * @param[in] triangles the vector of input triangles.
+     * @param[out] offsets the offsets of each face, followed by the total number of vertices.
+     * @param[out] vertices the concatenated vertices of all faces.
+     */
+    static
+    void flattenFaces( const std::vector<Triangle>& triangles,
+                       std::vector< Index >& offsets, std::vector< VertexIndex >& vertices );
+
+    /**
+     * Flattens the given polygonal faces: the vertices of face f are
+     * vertices[ offsets[ f ] ], ..., vertices[ offsets[ f + 1 ] - 1 ].
+     *
+     * @param[in] polygonal_faces the vector of input polygonal faces.
+     * @param[out] offsets the offsets of each face, followed by the total number of vertices.
+     * @param[out] vertices the concatenated vertices of all faces.
+     */
+    static
+    void flattenFaces( const std::vector<PolygonalFace>& polygonal_faces,
+                       std::vector< Index >& offsets, std::vector< VertexIndex >& vertices );
+
+    /**
+     * Computes the unoriented edges of flattened faces (see
+     * flattenFaces), by sorting their keys \a min * n + \a max, where
+     * n is one more than the maximal vertex index.
+     *
+     * @param[in] offsets the offsets of each face, followed by the total number of vertices.
+     * @param[in] vertices the concatenated vertices of all faces.
+     * @param[out] edges_out the vector of all the unoriented edges, in lexicographic order.
+     * @param[in] parallel when 'true', edges are sorted in parallel (with OpenMP).
+     *
+     * @return the total number of different vertices.
+     */
+    static
+    Size getUnorderedEdgesFromFaces( const std::vector< Index >& offsets,
+                                     const std::vector< VertexIndex >& vertices,
+                                     std::vector< Edge >& edges_out, bool parallel );
+
+    /**
+     * Builds the half-edge data structure from flattened faces (see
+     * flattenFaces) and edges. The arcs of faces and the arcs of
+     * half-edges are sorted by their keys \a tail * \a num_vertices +
+     * \a head, then merged to associate half-edges and faces. Edge
+     * \a ei gives half-edges 2 * \a ei and 2 * \a ei + 1.
+     *
+     * @param[in] num_vertices the number of vertices (one more than the
+     * maximal vertex index).
+     * @param[in] offsets the offsets of each face, followed by the total number of vertices.
+     * @param[in] vertices the concatenated vertices of all faces.
+     * @param[in] edges the vector of input unoriented edges.
+     * @param[in] parallel when 'true', arcs are sorted in parallel (with OpenMP).
+     *
+     * @return 'true' if everything went well, 'false' otherwise.
+     */
+    bool buildFromFaces( const Size num_vertices,
+                         const std::vector< Index >& offsets,
+                         const std::vector< VertexIndex >& vertices,
+                         const std::vector< Edge >& edges,
+                         bool parallel );
         
   }; // end of class HalfEdgeDataStructure
 
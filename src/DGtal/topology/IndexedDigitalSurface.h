@@ -47,8 +47,10 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/OwningOrAliasingPtr.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/graph/DenseVertexContainers.h"
 #include "DGtal/topology/HalfEdgeDataStructure.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
+#include "DGtal/topology/KhalimskyCellContainers.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -72,6 +74,11 @@ namespace DGtal
    * This object stores the positions of vertices in
    * space. If you need further data attached to the surface, you may
    * use property maps (see `IndexedDigitalSurface::makeVertexMap`).
+   * Since vertices are indices, the sets and maps of vertices of the
+   * graph interface (VertexSet, VertexMap) are DenseVertexSet and
+   * DenseVertexMap, and surfels, linels and pointels are mapped to
+   * their indices with open addressing hash maps (see
+   * FlatHashCellContainers).
    *
    * The user instantiates the object with a model of
    * concepts::CDigitalSurfaceContainer or a DigitalSurface.
@@ -116,12 +123,14 @@ namespace DGtal
     typedef std::vector<RealPoint>                   PositionsStorage;
     typedef std::vector<PolygonalFace>               PolygonalFacesStorage;
     typedef std::vector<SCell>                       SCellStorage;
+    /// Containers of the mappings from cells to indices.
+    typedef FlatHashCellContainers<KSpace>           CellMaps;
 
     // Required by CUndirectedSimpleLocalGraph
     typedef VertexIndex                              Vertex;
-    typedef std::set<Vertex>                         VertexSet;
+    typedef DenseVertexSet<Vertex>                   VertexSet;
     template <typename Value> struct                 VertexMap {
-      typedef typename std::map<Vertex, Value>       Type;
+      typedef DenseVertexMap<Vertex, Value>          Type;
     };
 
     // Required by CUndirectedSimpleGraph
@@ -263,14 +272,25 @@ namespace DGtal
     /// Builds the half-edge data structure from the given digital
     /// surface container. After that, the surface is valid.
     ///
+    /// When \a parallel is 'true' and DGtal is built with OpenMP,
+    /// the faces around the surfels, the vertices around the faces
+    /// and the separators of arcs are computed by chunks in
+    /// parallel, each thread with its own tracker on the container,
+    /// and the half-edge data structure is built with parallel sorts
+    /// (see HalfEdgeDataStructure::build). Vertices, arcs and faces
+    /// are numbered as in the serial build.
+    ///
     /// @param surfContainer any instance of digital surface
     /// container. Pass a CountedPtr or any variant if you wish to
     /// secure its aliasing.
     ///
+    /// @param parallel when 'true', the build is parallel (with OpenMP).
+    ///
     /// @return true if everything went allright, false if it was not
     /// possible to build a consistent data structure (e.g., butterfly
     /// neighborhoods).
-    bool build( ConstAlias< DigitalSurfaceContainer > surfContainer );
+    bool build( ConstAlias< DigitalSurfaceContainer > surfContainer,
+                bool parallel = false );
 
     /**
        @return a const reference to the stored container.
@@ -677,11 +697,11 @@ namespace DGtal
     /// Stores the polygonal faces.
     PolygonalFacesStorage myPolygonalFaces;
     /// Mapping Surfel ->  VertexIndex
-    std::map< SCell, VertexIndex > mySurfel2VertexIndex;
+    typename CellMaps::template SCellMap< VertexIndex >::Type mySurfel2VertexIndex;
     /// Mapping Linel  -> Arc
-    std::map< SCell, Arc >         myLinel2Arc;
+    typename CellMaps::template SCellMap< Arc >::Type         myLinel2Arc;
     /// Mapping Pointel -> FaceIndex
-    std::map< SCell, FaceIndex >   myPointel2FaceIndex;
+    typename CellMaps::template SCellMap< FaceIndex >::Type   myPointel2FaceIndex;
     /// Mapping VertexIndex -> Surfel
     SCellStorage          myVertexIndex2Surfel;
     /// Mapping Arc         -> Linel
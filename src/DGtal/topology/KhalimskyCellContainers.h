@@ -0,0 +1,359 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellContainers.h
+ *
+ * @date 2026/10/16
+ *
+ * @brief Traits selecting the types of sets and maps of cells of a
+ * Khalimsky space (ordered STL containers, flat hash containers or
+ * flat hash sets of packed cells).
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testFlatHashContainers.cpp
+ */
+
+#if defined(KhalimskyCellContainers_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellContainers.h
+#else // defined(KhalimskyCellContainers_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellContainers_RECURSES
+
+#if !defined KhalimskyCellContainers_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellContainers_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <stdexcept>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/FlatHashContainers.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/KhalimskyCellPacker.h"
+#include <boost/iterator/transform_iterator.hpp>
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StdCellContainers
+  /**
+     Description of template class 'StdCellContainers' <p> \brief Aim:
+     Traits class giving the preferred containers of cells of the
+     cellular grid space \a TKSpace, i.e. its own types
+     TKSpace::CellSet, TKSpace::SCellSet, TKSpace::SurfelSet,
+     TKSpace::CellMap, TKSpace::SCellMap and TKSpace::SurfelMap
+     (std::set and std::map for KhalimskySpaceND).
+
+     Together with FlatHashCellContainers, it lets generic code
+     select the containers of cells with a single template parameter.
+
+     @tparam TKSpace any model of concepts::CCellularGridSpaceND.
+  */
+  template < typename TKSpace >
+  struct StdCellContainers
+  {
+    typedef TKSpace                     KSpace;
+    typedef typename KSpace::Cell       Cell;
+    typedef typename KSpace::SCell      SCell;
+    typedef typename KSpace::CellSet    CellSet;
+    typedef typename KSpace::SCellSet   SCellSet;
+    typedef typename KSpace::SurfelSet  SurfelSet;
+
+    /// Template rebinding for defining a mapping Cell -> Value.
+    template <typename Value> struct CellMap {
+      typedef typename KSpace::template CellMap<Value>::Type Type;
+    };
+    /// Template rebinding for defining a mapping SCell -> Value.
+    template <typename Value> struct SCellMap {
+      typedef typename KSpace::template SCellMap<Value>::Type Type;
+    };
+    /// Template rebinding for defining a mapping Surfel -> Value.
+    template <typename Value> struct SurfelMap {
+      typedef typename KSpace::template SurfelMap<Value>::Type Type;
+    };
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatHashCellContainers
+  /**
+     Description of template class 'FlatHashCellContainers' <p>
+     \brief Aim: Traits class giving open addressing hash containers
+     (FlatHashSet, FlatHashMap) of cells of the cellular grid space \a
+     TKSpace, hashed with KhalimskyCellPackedHash.
+
+     These containers are unordered and, for sets of (signed) cells,
+     use a single array of cells instead of one node per cell: they
+     are both faster and smaller than std::set or std::unordered_set
+     (see testFlatHashContainers-benchmark.cpp). They are models of
+     associative containers and may be used wherever the order of
+     cells is irrelevant, for instance:
+
+     @code
+     typedef FlatHashCellContainers<KSpace> Containers;
+     Containers::SCellSet boundary;
+     Surfaces<KSpace>::trackBoundary( boundary, K, SAdj, set, bel );
+     SetOfSurfels< KSpace, Containers::SurfelSet > surface( K, SAdj, boundary );
+     CubicalComplex< KSpace, Containers::CellMap<CubicalCellData>::Type > complex( K );
+     @endcode
+
+     Note that inserting cells invalidates iterators and references
+     to cells when the table grows (see FlatHashSet).
+
+     @tparam TKSpace any model of concepts::CCellularGridSpaceND whose
+     cells are KhalimskyCell and SignedKhalimskyCell.
+  */
+  template < typename TKSpace >
+  struct FlatHashCellContainers
+  {
+    typedef TKSpace                     KSpace;
+    typedef typename KSpace::Cell       Cell;
+    typedef typename KSpace::SCell      SCell;
+    typedef FlatHashSet< Cell, KhalimskyCellPackedHash<Cell> >   CellSet;
+    typedef FlatHashSet< SCell, KhalimskyCellPackedHash<SCell> > SCellSet;
+    typedef FlatHashSet< SCell, KhalimskyCellPackedHash<SCell> > SurfelSet;
+
+    /// Template rebinding for defining a mapping Cell -> Value.
+    template <typename Value> struct CellMap {
+      typedef FlatHashMap< Cell, Value, KhalimskyCellPackedHash<Cell> > Type;
+    };
+    /// Template rebinding for defining a mapping SCell -> Value.
+    template <typename Value> struct SCellMap {
+      typedef FlatHashMap< SCell, Value, KhalimskyCellPackedHash<SCell> > Type;
+    };
+    /// Template rebinding for defining a mapping Surfel -> Value.
+    template <typename Value> struct SurfelMap {
+      typedef FlatHashMap< SCell, Value, KhalimskyCellPackedHash<SCell> > Type;
+    };
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedCellSet
+  /**
+     Description of template class 'PackedCellSet' <p> \brief Aim: An
+     unordered set of (unsigned or signed) cells of a KhalimskySpaceND,
+     which stores the cells packed in 64-bit words (see
+     KhalimskyCellPacker) in a FlatHashSet.
+
+     It offers the services of a set of cells used by surface tracking
+     and SetOfSurfels (insert, find, count, erase, iteration), but its
+     iterators unpack the cells on the fly: they return cells by value
+     and are only readable. In 3D with int32 coordinates, it uses half
+     the memory of a FlatHashSet of cells.
+
+     Cells must be packable. When the set is built from a space, the
+     bounds of the space are checked once (and an exception is thrown
+     if its cells cannot be packed). Otherwise (e.g. default
+     constructed by Surfaces::track*), each inserted cell is checked,
+     and looking for a cell that cannot be packed finds nothing.
+
+     @tparam TKSpace a KhalimskySpaceND.
+     @tparam TCell the type of cells, TKSpace::Cell or TKSpace::SCell.
+  */
+  template < typename TKSpace, typename TCell >
+  class PackedCellSet
+  {
+  public:
+    typedef PackedCellSet<TKSpace, TCell>      Self;
+    typedef KhalimskyCellPacker<TKSpace>       Packer;
+    typedef typename Packer::PackedCell        PackedCell;
+    typedef FlatHashSet<PackedCell>            Container;
+    typedef TCell                              key_type;
+    typedef TCell                              value_type;
+    typedef TCell                              reference;
+    typedef TCell                              const_reference;
+    typedef typename Container::size_type      size_type;
+    typedef typename Container::difference_type difference_type;
+
+    /// Functor unpacking cells.
+    struct Unpack {
+      typedef TCell result_type;
+      TCell operator()( PackedCell p ) const
+      {
+        TCell c;
+        Packer::unpack( p, c );
+        return c;
+      }
+    };
+    typedef boost::transform_iterator< Unpack,
+                                       typename Container::const_iterator > iterator;
+    typedef iterator const_iterator;
+
+    /// Constructor. The cells are checked one by one.
+    /// @param aBucketCount minimal number of slots.
+    explicit PackedCellSet( size_type aBucketCount = 0 )
+      : myPackedCells( aBucketCount ), myIsChecked( false ) {}
+
+    /// Constructor for the cells of a space, whose bounds are checked once.
+    /// @param K any space whose cells are packable.
+    /// @param aBucketCount minimal number of slots.
+    /// @throw std::out_of_range if some cells of @a K cannot be packed.
+    explicit PackedCellSet( const TKSpace & K, size_type aBucketCount = 0 )
+      : myPackedCells( aBucketCount ), myIsChecked( true )
+    { Packer::checkPackable( K ); }
+
+    /// Constructor from a range of cells.
+    /// @param first begin of the range.
+    /// @param last end of the range.
+    template <typename InputIterator>
+    PackedCellSet( InputIterator first, InputIterator last )
+      : myIsChecked( false )
+    { insert( first, last ); }
+
+    const_iterator begin() const { return makeIterator( myPackedCells.begin() ); }
+    const_iterator end() const   { return makeIterator( myPackedCells.end() ); }
+    /// @return 'true' iff the set is empty.
+    bool empty() const { return myPackedCells.empty(); }
+    /// @return the number of cells.
+    size_type size() const { return myPackedCells.size(); }
+    /// @return the maximal number of cells.
+    size_type max_size() const { return myPackedCells.max_size(); }
+    /// @return the number of bytes used by the packed cells.
+    size_type memoryUsage() const { return myPackedCells.memoryUsage(); }
+    /// Removes all the cells.
+    void clear() { myPackedCells.clear(); }
+    /// Makes room for @a n cells.
+    /// @param n any number of cells.
+    void reserve( size_type n ) { myPackedCells.reserve( n ); }
+    /// Swaps the content of 'this' and of @a other.
+    /// @param other any other set.
+    void swap( PackedCellSet & other )
+    {
+      myPackedCells.swap( other.myPackedCells );
+      std::swap( myIsChecked, other.myIsChecked );
+    }
+
+    /// Inserts a cell.
+    /// @param c any packable cell.
+    /// @return an iterator on the cell, and 'true' iff it was inserted.
+    /// @throw std::out_of_range if @a c cannot be packed.
+    std::pair<iterator, bool> insert( const TCell & c )
+    {
+      if ( ! isPackable( c ) )
+        throw std::out_of_range( "PackedCellSet::insert: the cell cannot be packed." );
+      auto r = myPackedCells.insert( Packer::pack( c ) );
+      return std::make_pair( makeIterator( r.first ), r.second );
+    }
+    /// Inserts a cell (the hint is ignored).
+    /// @param c any packable cell.
+    /// @return an iterator on the cell.
+    iterator insert( const_iterator, const TCell & c )
+    { return insert( c ).first; }
+    /// Inserts a range of cells.
+    /// @param first begin of the range.
+    /// @param last end of the range.
+    template <typename InputIterator>
+    void insert( InputIterator first, InputIterator last )
+    {
+      for ( ; first != last; ++first ) insert( *first );
+    }
+    /// @param c any cell.
+    /// @return an iterator on this cell or end().
+    const_iterator find( const TCell & c ) const
+    {
+      return isPackable( c ) ? makeIterator( myPackedCells.find( Packer::pack( c ) ) )
+                             : end();
+    }
+    /// @param c any cell.
+    /// @return the number of cells equal to @a c (0 or 1).
+    size_type count( const TCell & c ) const
+    { return isPackable( c ) ? myPackedCells.count( Packer::pack( c ) ) : 0; }
+    /// @param c any cell.
+    /// @return the number of erased cells (0 or 1).
+    size_type erase( const TCell & c )
+    { return isPackable( c ) ? myPackedCells.erase( Packer::pack( c ) ) : 0; }
+    /// @param pos a valid dereferenceable iterator.
+    /// @return an iterator on the next cell.
+    iterator erase( const_iterator pos )
+    { return makeIterator( myPackedCells.erase( pos.base() ) ); }
+
+    /// @return the underlying set of packed cells.
+    const Container & packedCells() const { return myPackedCells; }
+    /// @return the underlying set of packed cells.
+    Container & packedCells() { return myPackedCells; }
+
+    /// @param other any other set.
+    /// @return 'true' iff they have the same cells.
+    bool operator==( const PackedCellSet & other ) const
+    { return myPackedCells == other.myPackedCells; }
+    /// @param other any other set.
+    /// @return 'true' iff they do not have the same cells.
+    bool operator!=( const PackedCellSet & other ) const
+    { return myPackedCells != other.myPackedCells; }
+
+  private:
+    /// @param it an iterator on a packed cell.
+    /// @return the corresponding iterator on the cell.
+    static const_iterator makeIterator( typename Container::const_iterator it )
+    { return const_iterator( it, Unpack() ); }
+
+    /// @param c any cell.
+    /// @return 'true' iff @a c is packable (always when the bounds of
+    /// the space have been checked).
+    bool isPackable( const TCell & c ) const
+    { return myIsChecked || Packer::isPackable( c.preCell().coordinates ); }
+
+    /// The set of packed cells.
+    Container myPackedCells;
+    /// 'true' iff the bounds of the space have been checked.
+    bool myIsChecked;
+  };
+
+  /// Defines container traits for PackedCellSet<>.
+  template < typename TKSpace, typename TCell >
+  struct ContainerTraits< PackedCellSet<TKSpace, TCell> >
+  {
+    typedef UnorderedSetAssociativeCategory Category;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedCellContainers
+  /**
+     Description of template class 'PackedCellContainers' <p>
+     \brief Aim: Traits class giving the most compact containers of
+     cells of a KhalimskySpaceND: PackedCellSet for sets of cells, and
+     the maps of FlatHashCellContainers (maps need references to
+     their keys, hence cannot store packed cells).
+
+     Cells must be packable (see KhalimskyCellPacker), e.g. digital
+     coordinates in [-2^19, 2^19) in 3D: PackedCellSet checks it and
+     throws otherwise.
+
+     @tparam TKSpace a KhalimskySpaceND.
+  */
+  template < typename TKSpace >
+  struct PackedCellContainers : public FlatHashCellContainers< TKSpace >
+  {
+    typedef TKSpace                     KSpace;
+    typedef typename KSpace::Cell       Cell;
+    typedef typename KSpace::SCell      SCell;
+    typedef PackedCellSet< KSpace, Cell >  CellSet;
+    typedef PackedCellSet< KSpace, SCell > SCellSet;
+    typedef PackedCellSet< KSpace, SCell > SurfelSet;
+  };
+
+} // namespace DGtal
+
+#endif // !defined KhalimskyCellContainers_h
+
+#undef KhalimskyCellContainers_RECURSES
+#endif // else defined(KhalimskyCellContainers_RECURSES)
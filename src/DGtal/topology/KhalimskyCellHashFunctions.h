@@ -44,6 +44,76 @@
 #include <boost/functional/hash.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
+namespace DGtal {
+
+  namespace detail {
+    /**
+     * Packs the Khalimsky coordinates of a cell in a 64-bit word, each
+     * coordinate using 63/dim bits (21 bits in 3D), after a seed bit
+     * (e.g. the sign of the cell). The packing is injective as long as
+     * the Khalimsky coordinates fit in these bits, which holds for all
+     * usual digital spaces.
+     *
+     * @param aCoords the Khalimsky coordinates.
+     * @param aSeed the seed bit (0 or 1).
+     * @return the packed coordinates.
+     */
+    template < typename TPoint >
+    inline
+    DGtal::uint64_t
+    packKhalimskyCoordinates( const TPoint & aCoords, DGtal::uint64_t aSeed )
+    {
+      typedef typename TPoint::Component Integer;
+      const unsigned int bits = ( TPoint::dimension < 63 ) ? 63 / TPoint::dimension : 1;
+      const DGtal::uint64_t mask = ( ( (DGtal::uint64_t) 1 ) << bits ) - 1;
+      DGtal::uint64_t h = aSeed;
+      for ( auto const& c : aCoords )
+        h = ( ( h << bits ) | ( h >> ( 64 - bits ) ) )
+          ^ ( static_cast<DGtal::uint64_t>( NumberTraits<Integer>::castToInt64_t( c ) ) & mask );
+      return h;
+    }
+  }
+
+  /** @brief
+   * Hash functor on DGtal::KhalimskyCell and
+   * DGtal::SignedKhalimskyCell, that packs the Khalimsky coordinates
+   * (and the sign) in a 64-bit word. Contrary to std::hash, which
+   * combines the coordinates with boost::hash_range, it is injective
+   * for usual digital spaces and costs a few shifts. It is meant to be
+   * used by open addressing tables, which mix the hash values (see
+   * FlatHashSet and KhalimskyCellContainers.h).
+   *
+   * @tparam TCell the type of cells.
+   */
+  template < typename TCell >
+  struct KhalimskyCellPackedHash;
+
+  /// Packed hash functor on DGtal::KhalimskyCell.
+  template < DGtal::Dimension dim,
+             typename TInteger >
+  struct KhalimskyCellPackedHash< DGtal::KhalimskyCell< dim, TInteger > >
+  {
+    std::size_t operator()( const DGtal::KhalimskyCell< dim, TInteger > & pp ) const
+    {
+      return static_cast<std::size_t>
+        ( detail::packKhalimskyCoordinates( pp.preCell().coordinates, 0 ) );
+    }
+  };
+
+  /// Packed hash functor on DGtal::SignedKhalimskyCell.
+  template < DGtal::Dimension dim,
+             typename TInteger >
+  struct KhalimskyCellPackedHash< DGtal::SignedKhalimskyCell< dim, TInteger > >
+  {
+    std::size_t operator()( const DGtal::SignedKhalimskyCell< dim, TInteger > & pp ) const
+    {
+      auto const& p = pp.preCell();
+      return static_cast<std::size_t>
+        ( detail::packKhalimskyCoordinates( p.coordinates, p.positive ? 1 : 0 ) );
+    }
+  };
+
+}
 
 namespace std {
   /** @brief
@@ -0,0 +1,337 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellPacker.h
+ *
+ * @date 2026/10/16
+ *
+ * @brief Packing of the cells of a Khalimsky space in 64-bit words,
+ * and incidence/adjacency services on packed cells.
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testKhalimskyCellPacker.cpp
+ */
+
+#if defined(KhalimskyCellPacker_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellPacker.h
+#else // defined(KhalimskyCellPacker_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellPacker_RECURSES
+
+#if !defined KhalimskyCellPacker_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellPacker_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellPacker
+  /**
+     Description of template class 'KhalimskyCellPacker' <p> \brief
+     Aim: Packs the Khalimsky coordinates and the sign of the cells of
+     a KhalimskySpaceND in a single 64-bit word, and provides the
+     usual incidence and adjacency services directly on these words
+     with a few bit operations.
+
+     Each Khalimsky coordinate uses 63/dim bits (21 bits in 3D, 31
+     bits in 2D) and is stored with a bias (half of its range), the
+     coordinate 0 in the most significant bits and the sign in bit 63.
+     Hence packed cells compare as their cells: for cells c and d,
+     pack(c) < pack(d) iff c < d. A cell is packable whenever its
+     Khalimsky coordinates lie in [-2^(b-1), 2^(b-1)), b = 63/dim,
+     i.e. digital coordinates in [-2^19, 2^19) in 3D. Packing a cell
+     that is not packable gives the packed cell of another cell: use
+     isPackable( K ) or checkPackable( K ) once per space (as
+     PackedCellSet does) rather than a check per cell.
+
+     Packed cells are twice smaller than cells in 3D with int32
+     coordinates (16 bytes, with the sign and padding), hash and
+     compare as integers, which makes them the preferred keys of large
+     sets of cells (see PackedCellSet in KhalimskyCellContainers.h).
+
+     The services on packed cells mirror the ones of KhalimskySpaceND
+     (prefixes u and s) but, being static, do not check the bounds of
+     the space nor its periodicity: they are valid as long as the
+     resulting cell stays in the bounds of a non-periodic space (or
+     away from the periodic borders).
+
+     @code
+     typedef KhalimskyCellPacker<Z3i::KSpace> Packer;
+     Packer::PackedCell b = Packer::pack( bel );
+     for ( Dimension k = 0; k < 3; ++k )
+       if ( k != Packer::orthDir( b ) )
+         {
+           Packer::PackedCell pl = Packer::sDirectIncident( b, k );
+           ...
+         }
+     SCell linel = Packer::sUnpack( pl );
+     @endcode
+
+     @tparam TKSpace a KhalimskySpaceND.
+  */
+  template < typename TKSpace >
+  class KhalimskyCellPacker
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    /// The type of packed cells (unsigned or signed).
+    typedef DGtal::uint64_t PackedCell;
+
+    /// The dimension of the space.
+    static const Dimension dimension = KSpace::dimension;
+    BOOST_STATIC_ASSERT(( dimension >= 1 && dimension <= 31 ));
+    /// The number of bits of each Khalimsky coordinate.
+    static const unsigned int bits = 63 / dimension;
+
+    // ----------------------- Packing services -------------------------
+  public:
+
+    /**
+     * @param kp any Khalimsky coordinates.
+     * @return 'true' iff a cell with these coordinates can be packed.
+     */
+    static bool isPackable( const Point & kp );
+
+    /**
+     * @param K any space.
+     * @return 'true' iff all the cells of @a K can be packed.
+     */
+    static bool isPackable( const KSpace & K );
+
+    /**
+     * Checks that all the cells of a space can be packed.
+     *
+     * @param K any space.
+     * @throw std::out_of_range if some cells of @a K cannot be packed.
+     */
+    static void checkPackable( const KSpace & K );
+
+    /**
+     * @param c any packable unsigned cell (only checked in debug mode).
+     * @return the packed cell.
+     */
+    static PackedCell uPack( const Cell & c );
+
+    /**
+     * @param c any packable signed cell (only checked in debug mode).
+     * @return the packed cell.
+     */
+    static PackedCell sPack( const SCell & c );
+
+    /// @param c any packable unsigned cell.
+    /// @return the packed cell (same as uPack).
+    static PackedCell pack( const Cell & c );
+
+    /// @param c any packable signed cell.
+    /// @return the packed cell (same as sPack).
+    static PackedCell pack( const SCell & c );
+
+    /**
+     * @param p any packed unsigned cell.
+     * @return the unsigned cell.
+     */
+    static Cell uUnpack( PackedCell p );
+
+    /**
+     * @param p any packed signed cell.
+     * @return the signed cell.
+     */
+    static SCell sUnpack( PackedCell p );
+
+    /// Unpacks an unsigned cell (generic form of uUnpack).
+    /// @param p any packed unsigned cell.
+    /// @param[out] c the unsigned cell.
+    static void unpack( PackedCell p, Cell & c );
+
+    /// Unpacks a signed cell (generic form of sUnpack).
+    /// @param p any packed signed cell.
+    /// @param[out] c the signed cell.
+    static void unpack( PackedCell p, SCell & c );
+
+    // ----------------------- Read accessors -------------------------
+  public:
+
+    /**
+     * @param p any packed cell.
+     * @param k any valid dimension.
+     * @return its Khalimsky coordinate along @a k.
+     */
+    static Integer kCoord( PackedCell p, Dimension k );
+
+    /**
+     * @param p any packed cell.
+     * @param k any valid dimension.
+     * @return 'true' iff the cell is open along @a k.
+     */
+    static bool isOpen( PackedCell p, Dimension k );
+
+    /**
+     * @param p any packed cell.
+     * @return its dimension (number of open coordinates).
+     */
+    static Dimension dim( PackedCell p );
+
+    /**
+     * @param p any packed cell.
+     * @return 'true' iff it is a surfel.
+     */
+    static bool isSurfel( PackedCell p );
+
+    /**
+     * @param p any packed surfel.
+     * @return the direction along which the surfel is closed.
+     */
+    static Dimension orthDir( PackedCell p );
+
+    /**
+     * @param p any packed signed cell.
+     * @return 'true' iff it is positive.
+     */
+    static bool sSign( PackedCell p );
+
+    // ----------------------- Sign services -------------------------
+  public:
+
+    /// @param p any packed signed cell.
+    /// @return the packed cell with the opposite sign.
+    static PackedCell sOpp( PackedCell p );
+
+    /// @param p any packed signed cell.
+    /// @return the packed unsigned cell.
+    static PackedCell unsigns( PackedCell p );
+
+    /// @param p any packed unsigned cell.
+    /// @param positive the sign.
+    /// @return the packed signed cell with this sign.
+    static PackedCell signs( PackedCell p, bool positive );
+
+    // ----------------------- Neighborhood services -------------------------
+  public:
+
+    /**
+     * @param p any packed (unsigned or signed) cell.
+     * @param k any valid dimension.
+     * @param up if 'true' the orientation is forward along axis @a k,
+     * otherwise backward.
+     * @return the adjacent packed cell along @a k (same sign).
+     */
+    static PackedCell adjacent( PackedCell p, Dimension k, bool up );
+
+    /**
+     * @param p any packed unsigned cell.
+     * @param k any valid dimension.
+     * @param up if 'true' the orientation is forward along axis @a k,
+     * otherwise backward.
+     * @return the incident packed cell along @a k.
+     */
+    static PackedCell uIncident( PackedCell p, Dimension k, bool up );
+
+    /**
+     * @param p any packed signed cell.
+     * @param k any valid dimension.
+     * @param up if 'true' the orientation is forward along axis @a k,
+     * otherwise backward.
+     * @return the incident packed signed cell along @a k, with the
+     * sign given by KhalimskySpaceND::sIncident.
+     */
+    static PackedCell sIncident( PackedCell p, Dimension k, bool up );
+
+    /**
+     * @param p any packed signed cell.
+     * @param k any valid dimension.
+     * @return the direct orientation of @a p along @a k (see
+     * KhalimskySpaceND::sDirect).
+     */
+    static bool sDirect( PackedCell p, Dimension k );
+
+    /**
+     * @param p any packed signed cell.
+     * @param k any valid dimension.
+     * @return the direct incident packed cell of @a p along @a k (positive).
+     */
+    static PackedCell sDirectIncident( PackedCell p, Dimension k );
+
+    /**
+     * @param p any packed signed cell.
+     * @param k any valid dimension.
+     * @return the indirect incident packed cell of @a p along @a k (negative).
+     */
+    static PackedCell sIndirectIncident( PackedCell p, Dimension k );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the packed cell on an output stream.
+     * @param out the output stream where the object is written.
+     * @param p any packed signed cell.
+     */
+    static void selfDisplay ( std::ostream & out, PackedCell p );
+
+    // ------------------------- Private services -----------------------------
+  private:
+    /// Bias added to Khalimsky coordinates.
+    static const DGtal::uint64_t bias = ( (DGtal::uint64_t) 1 ) << ( bits - 1 );
+    /// Mask of one coordinate.
+    static const DGtal::uint64_t mask = ( ( (DGtal::uint64_t) 1 ) << bits ) - 1;
+    /// The sign bit.
+    static const DGtal::uint64_t signBit = ( (DGtal::uint64_t) 1 ) << 63;
+
+    /// @param k any valid dimension.
+    /// @return the position of the lowest bit of coordinate @a k.
+    static unsigned int shift( Dimension k );
+    /// @return the mask of the lowest bits of all coordinates.
+    static DGtal::uint64_t parityMask();
+    /// @param k any valid dimension.
+    /// @return the number of open coordinates among 0, ..., @a k, modulo 2.
+    static bool openParity( PackedCell p, Dimension k );
+
+  }; // end of class KhalimskyCellPacker
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/KhalimskyCellPacker.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellPacker_h
+
+#undef KhalimskyCellPacker_RECURSES
+#endif // else defined(KhalimskyCellPacker_RECURSES)
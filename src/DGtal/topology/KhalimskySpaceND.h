@@ -70,6 +70,13 @@ namespace DGtal
   template < class TKhalimskySpace >
   class KhalimskySpaceNDHelper;
 
+  /////////////////////////////////////////////////////////////////////////////
+  /** @brief Packs the cells of a KhalimskySpaceND in 64-bit words
+   * (see KhalimskyCellPacker.h).
+   */
+  template < class TKhalimskySpace >
+  class KhalimskyCellPacker;
+
   /////////////////////////////////////////////////////////////////////////////
   /**
    * @brief Represents an (unsigned) cell in a cellular grid space by its
@@ -99,6 +106,7 @@ namespace DGtal
     // Friendship
     friend class KhalimskySpaceND< dim, TInteger >;
     friend class KhalimskySpaceNDHelper< CellularGridSpace >;
+    friend class KhalimskyCellPacker< CellularGridSpace >;
 
   private:
     /// Underlying pre-cell
@@ -223,6 +231,7 @@ namespace DGtal
     // Friendship
     friend class KhalimskySpaceND< dim, TInteger >;
     friend class KhalimskySpaceNDHelper< CellularGridSpace >;
+    friend class KhalimskyCellPacker< CellularGridSpace >;
 
   private:
     /// Underlying signed pre-cell
@@ -41,8 +41,11 @@
 // Inclusions
 #include <iostream>
 #include <bitset>
+#include <string>
+#include <cstddef>
 #include <unordered_map>
 #include "boost/dynamic_bitset.hpp"
+#include <DGtal/base/Common.h>
 #include <DGtal/base/CountedPtr.h>
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
 
@@ -64,11 +67,84 @@ namespace DGtal {
    * At build or install time, the header
    * "DGtal/topology/tables/NeighborhoodTables.h" is generated.
    * It has const strings variables with the file names of the tables.
+   *
+   * @note The zlib stream is inflated in one buffer and its characters
+   * are packed directly in the blocks of the bitset. A binary table
+   * written by saveTable is recognized by its header (whatever @a
+   * compressed) and read as is, without decompression.
    */
   inline
   DGtal::CountedPtr< boost::dynamic_bitset<> >
   loadTable(const std::string & input_filename, const unsigned int known_size, const bool compressed = true );
 
+  /**
+   * Saves a look up table in binary form: the 8 characters
+   * "DGtalLUT", the number of bits of the table, then the bits
+   * packed in 64-bit words (bit i in bit i%64 of word i/64), all
+   * integers being little-endian. Such a file is read by loadTable
+   * (and loadSharedTable) in one read, without decompression nor
+   * parsing.
+   *
+   * @param table any table [configuration] -> bool.
+   * @param output_filename the name of the written file.
+   *
+   * @see binaryTableFilename
+   */
+  inline
+  void
+  saveTable(const boost::dynamic_bitset<> & table, const std::string & output_filename);
+
+  /**
+   * @param input_filename the file name of a table, e.g.
+   * simplicity::tableSimple26_6.
+   *
+   * @return the file name of its uncompressed binary sidecar, the
+   * extension ".zlib" being replaced by ".bin" (or ".bin" being
+   * appended).
+   */
+  inline
+  std::string
+  binaryTableFilename(const std::string & input_filename);
+
+  /**
+   * Lazily loaded table shared by the whole process: the first call
+   * for a file name loads the table, and the next calls (from any
+   * thread, any Object, VoxelComplex or SubfieldThinning) return the
+   * same instance. If the binary sidecar binaryTableFilename(
+   * input_filename ) exists (see saveTable), it is read instead of
+   * the compressed table.
+   *
+   * The table is owned by the library and lives until the end of the
+   * process: there is no reference counting, hence the returned
+   * reference may be copied, stored or aliased (e.g. by
+   * Object::setTable) concurrently from several threads.
+   *
+   * @param input_filename the file name of a table, e.g.
+   * simplicity::tableSimple26_6.
+   * @param known_size of the bitset, for 2D = 256 (2^8), 3D = 67108864 (2^26)
+   * @param compressed true if table to read has been compressed with zlib.
+   *
+   * @return a const reference to the shared map[neighbor_configuration] -> bool.
+   */
+  inline
+  const boost::dynamic_bitset<> &
+  loadSharedTable(const std::string & input_filename, const unsigned int known_size, const bool compressed = true );
+
+  /**
+   * Lazily loaded table shared by the whole process.
+   *
+   * @tparam dimension of the space input_filename table refers. 2 or 3
+   * @param input_filename the file name of a table.
+   * @param compressed true if table to read has been compressed with zlib.
+   * @return a const reference to the shared map[neighbor_configuration] -> bool.
+   *
+   * @see loadSharedTable(const std::string &, const unsigned int, const bool)
+   */
+  template<unsigned int dimension = 3>
+  inline
+  const boost::dynamic_bitset<> &
+  loadSharedTable(const std::string & input_filename, const bool compressed = true);
+
   /**
    * Load existing look up table existing in file_name, precalculated
    * tables can be accessed including the header:
@@ -114,6 +190,79 @@ namespace DGtal {
   std::unordered_map<TPoint, NeighborhoodConfiguration > >
   mapZeroPointNeighborhoodToConfigurationMask();
 
+  /**
+   * Computes the configuration of the neighbors of a point from the
+   * rows of a bit-packed binary image, with shifts and masks only (no
+   * branch and no lookup): the 3 bits around the point are extracted
+   * from each of the 3 (2D) or 9 (3D) neighboring rows and the bit of
+   * the point itself is squeezed out. The bit order is the one of
+   * mapZeroPointNeighborhoodToConfigurationMask, hence the result
+   * indexes the tables of NeighborhoodTables.h.
+   *
+   * Rows are sequences of 64-bit words, the bit b of the word w being
+   * the point of abscissa 64w + b. Neighboring rows are at @a
+   * rowStride words (second axis) and @a sliceStride words (third
+   * axis) from each other.
+   *
+   * @tparam dimension 2 or 3.
+   * @param row the words of the row of the point.
+   * @param rowStride the distance (in words) between two consecutive
+   * rows along the second axis.
+   * @param sliceStride the distance (in words) between two consecutive
+   * rows along the third axis (unused in 2D).
+   * @param x the abscissa of the point in its row (x >= 0).
+   * @return the configuration of the neighbors of the point.
+   *
+   * @pre the words (x-1)/64 (rounded down, possibly -1) and the next
+   * one of the 3 or 9 rows can be read, and the bits out of the image
+   * are zero, e.g. rows padded with a zero word on each side and
+   * surrounded by zero rows (see ImageContainerByBitVector).
+   */
+  template <unsigned int dimension = 3>
+  inline
+  NeighborhoodConfiguration
+  getNeighborhoodConfigurationOccupancy( const DGtal::uint64_t* row,
+                                         std::ptrdiff_t rowStride,
+                                         std::ptrdiff_t sliceStride,
+                                         DGtal::int64_t x );
+
+  /**
+   * Tests at once the 64 points of a word of a bit-packed binary
+   * image: returns the points of the image whose configuration (see
+   * getNeighborhoodConfigurationOccupancy) belongs to @a table, e.g.
+   * the simple points with a simplicity table.
+   *
+   * The 26 (3D) or 8 (2D) neighbors of the 64 points are obtained as
+   * 64-bit words by shifting the neighboring rows by one bit. The
+   * points whose neighbors are all in the image (resp. all out of the
+   * image) are decided at once by the configuration of all (resp. no)
+   * neighbors; the configurations of the other points are gathered
+   * from these words and looked up in @a table.
+   *
+   * @tparam dimension 2 or 3.
+   * @param table any table [configuration] -> bool, e.g. loaded from
+   * simplicity::tableSimple26_6.
+   * @param word a word of a row, the bit b being the point of abscissa
+   * 64w + b in the row if @a word is its w-th word.
+   * @param rowStride the distance (in words) between two consecutive
+   * rows along the second axis.
+   * @param sliceStride the distance (in words) between two consecutive
+   * rows along the third axis (unused in 2D).
+   * @return the word whose bit b is set iff the bit b of @a word is
+   * set and the configuration of its point belongs to @a table.
+   *
+   * @pre the words before and after @a word in the 3 or 9 rows can be
+   * read and the bits out of the image are zero (see
+   * getNeighborhoodConfigurationOccupancy).
+   */
+  template <unsigned int dimension = 3>
+  inline
+  DGtal::uint64_t
+  getSimplePointsOfWord( const boost::dynamic_bitset<> & table,
+                         const DGtal::uint64_t* word,
+                         std::ptrdiff_t rowStride,
+                         std::ptrdiff_t sliceStride );
+
   } // namespace functions
 } // namespace DGtal
 
@@ -277,9 +277,19 @@ namespace DGtal
     /**
      * Clone into the object pre-computed look up table to speed up isSimple calculation.
      *
-     * @param inputTable table loaded using functions::loadTable from NeighborhoodConfigurations.h
+     * @param inputTable table loaded using functions::loadTable or
+     * functions::loadSharedTable from NeighborhoodConfigurations.h
      */
-    void setTable(Alias<boost::dynamic_bitset<> >inputTable);
+    void setTable(ConstAlias<boost::dynamic_bitset<> >inputTable);
+
+    /**
+     * Uses the look up table of file name @a tableFilename shared by
+     * the whole process (see functions::loadSharedTable): it is
+     * loaded once, whatever the number of objects using it.
+     *
+     * @param tableFilename the file name of a table, e.g. simplicity::tableSimple26_6.
+     */
+    void setTable(const std::string & tableFilename);
 
     /**
      * Get the occupancy configuration of the neighborhood of a point. The neighborhood only depends on the dimension, not the topology of the object (3x3 cube for 3D point, 2x2 square for 2D).
@@ -662,7 +672,7 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
     /**
      * pointer to look-up-table to speed up isSimple
      * */
-    CountedPtrOrPtr<boost::dynamic_bitset<> > myTable;
+    CountedConstPtrOrConstPtr<boost::dynamic_bitset<> > myTable;
 
     /**
      * Neighborhood configuration points to bit mask. Needed to use table.
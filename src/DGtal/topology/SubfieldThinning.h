@@ -0,0 +1,350 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SubfieldThinning.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module SubfieldThinning.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testSubfieldThinning.cpp
+ */
+
+#if defined(SubfieldThinning_RECURSES)
+#error Recursive header files inclusion detected in SubfieldThinning.h
+#else // defined(SubfieldThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SubfieldThinning_RECURSES
+
+#if !defined SubfieldThinning_h
+/** Prevents repeated inclusion of headers. */
+#define SubfieldThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include <string>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/images/ImageContainerByBitVector.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SubfieldThinning
+  /**
+   * Description of template class 'SubfieldThinning' <p>
+   * \brief Aim: Thins a 3D binary image, stored with one bit per voxel in
+   * an ImageContainerByBitVector, by removing simple voxels in parallel
+   * with a directional and subfield scheme.
+   *
+   * The simplicity of a voxel is read in a precomputed table of
+   * NeighborhoodTables.h (for instance simplicity::tableSimple26_6)
+   * indexed by the configuration of its 26 neighbors. The simplicity
+   * of a voxel only depends on its 26 neighbors, and two distinct
+   * voxels of the same subfield (same parities of their coordinates)
+   * are never 26-adjacent. Hence all the simple voxels of a subfield
+   * may be removed simultaneously, which is equivalent to removing
+   * them one after the other: the thinned image is obtained by a
+   * sequence of simple voxel deletions and is homotopy equivalent to
+   * the input image, as the results of
+   * functions::asymetricThinningScheme.
+   *
+   * Only the border voxels are queued. The queue is ordered by the
+   * priority of the voxels (e.g. a distance transformation, so that
+   * the voxels nearest to the background are removed first), and the
+   * voxels of equal priority form a band. The voxels of a band are
+   * processed by rounds of 6 directional sub-iterations (-x, +x, -y,
+   * +y, -z, +z), each one made of 8 subfield passes. A pass only
+   * reads the image and decides which voxels of the subfield that are
+   * border voxels in the current direction are removed, so it is
+   * evaluated in parallel with OpenMP (with a dynamic schedule, idle
+   * threads taking the remaining chunks of voxels), then the removals
+   * are applied. Rounds are repeated until the band is stable, then
+   * the neighbors of the removed voxels are queued. The result does
+   * not depend on the number of threads.
+   *
+   * Voxels may be fixed, i.e. never removed. A skeleton table (for
+   * instance isthmusicity::tableIsthmus) may be given: a queued voxel
+   * whose configuration belongs to it is fixed, like the voxels of
+   * the constraint set K of functions::asymetricThinningScheme with
+   * skelWithTable. Without skeleton table, the result is an ultimate
+   * skeleton.
+   *
+   * @code
+   * ImageContainerByBitVector<Z3i::Domain> image( domain );
+   * for ( auto p : aDigitalSet ) image.setValue( p, true );
+   * SubfieldThinning<Z3i::Domain> thinning( image, simplicity::tableSimple26_6 );
+   * thinning.setSkeletonTable( isthmusicity::tableIsthmus );
+   * thinning.thin( true );
+   * @endcode
+   *
+   * @tparam TDomain a 3D HyperRectDomain.
+   *
+   * @see functions::asymetricThinningScheme
+   * @see testSubfieldThinning.cpp
+   */
+  template <typename TDomain>
+  class SubfieldThinning
+  {
+  public:
+    typedef SubfieldThinning<TDomain> Self;
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Integer Integer;
+    /// The type of the indices of the voxels (and of the numbers of voxels).
+    typedef DGtal::uint64_t Index;
+    typedef typename Domain::Dimension Dimension;
+    /// The thinned binary image.
+    typedef ImageContainerByBitVector<Domain> Image;
+    /// The tables [configuration] -> bool.
+    typedef boost::dynamic_bitset<> ConfigMap;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+    BOOST_STATIC_ASSERT(( dimension == 3 ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param image the binary image that is thinned (aliased).
+     * @param simplicityTable the simplicity table of the 26 neighbors
+     * configurations, e.g. loaded from simplicity::tableSimple26_6.
+     */
+    SubfieldThinning( Alias<Image> image,
+                      ConstAlias<ConfigMap> simplicityTable );
+
+    /**
+     * Constructor from the file name of the simplicity table, which is
+     * the table shared by the whole process (see
+     * functions::loadSharedTable).
+     *
+     * @param image the binary image that is thinned (aliased).
+     * @param simplicityTableFilename the file name of the simplicity
+     * table, e.g. simplicity::tableSimple26_6.
+     */
+    SubfieldThinning( Alias<Image> image,
+                      const std::string & simplicityTableFilename );
+
+    /**
+     * Destructor.
+     */
+    ~SubfieldThinning() = default;
+
+    /// Copy constructor.
+    SubfieldThinning( const SubfieldThinning & other ) = default;
+
+    /// Assignment.
+    SubfieldThinning & operator=( const SubfieldThinning & other ) = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Sets the skeleton table: the voxels whose configuration belongs
+     * to it are fixed when they are examined.
+     *
+     * @param skeletonTable a table [configuration] -> bool, e.g. loaded
+     * from isthmusicity::tableIsthmus.
+     */
+    void setSkeletonTable( ConstAlias<ConfigMap> skeletonTable );
+
+    /**
+     * Sets the skeleton table shared by the whole process (see
+     * functions::loadSharedTable).
+     *
+     * @param skeletonTableFilename the file name of a table, e.g.
+     * isthmusicity::tableIsthmus.
+     */
+    void setSkeletonTable( const std::string & skeletonTableFilename );
+
+    /// Removes the skeleton table (ultimate thinning).
+    void clearSkeletonTable();
+
+    /**
+     * Fixes a voxel, which is never removed.
+     * @param p any point of the domain.
+     */
+    void fix( const Point & p );
+
+    /**
+     * @param p any point of the domain.
+     * @return 'true' iff the voxel @a p is fixed.
+     */
+    bool isFixed( const Point & p ) const;
+
+    /// @return the image of the fixed voxels.
+    const Image & fixedVoxels() const;
+
+    /// @return the thinned image.
+    const Image & image() const;
+
+    /**
+     * @return the border voxels of the image, i.e. the voxels having
+     * at least one of their 6 neighbors out of the object (or of the
+     * domain), as indices of the image (see index()), in increasing
+     * order. Computed with word operations on the rows of the image.
+     *
+     * @param parallel when 'true' and OpenMP is available, the rows are
+     * scanned in parallel.
+     */
+    std::vector<Index> borderVoxels( bool parallel = false ) const;
+
+    /**
+     * Thins the image, all voxels having the same priority.
+     *
+     * @param parallel when 'true' and OpenMP is available, the subfield
+     * passes are evaluated in parallel.
+     * @param verbose when 'true', displays the progress with trace.
+     * @return the number of removed voxels.
+     */
+    Index thin( bool parallel = false, bool verbose = false );
+
+    /**
+     * Thins the image, removing first the voxels of lowest priority.
+     *
+     * @tparam TPriority the type of a functor Point -> priority (e.g. an
+     * image or a distance transformation), the priorities being
+     * compared with operator<.
+     * @param priority the priority functor.
+     * @param parallel when 'true' and OpenMP is available, the subfield
+     * passes are evaluated in parallel.
+     * @param verbose when 'true', displays the progress with trace.
+     * @return the number of removed voxels.
+     *
+     * @note The voxels of equal priority are processed together, so
+     * rounding real priorities (e.g. Euclidean distances) gives larger
+     * bands and more parallelism.
+     */
+    template <typename TPriority>
+    Index thin( const TPriority & priority, bool parallel = false, bool verbose = false );
+
+    /**
+     * @param p any point of the domain.
+     * @return its index in the image, x-major.
+     */
+    Index index( const Point & p ) const;
+
+    /**
+     * @param i any index of a point of the domain.
+     * @return the point of index @a i.
+     */
+    Point point( Index i ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The thinned image.
+    Image* myImage;
+    /// The simplicity table.
+    CountedConstPtrOrConstPtr<ConfigMap> mySimplicityTable;
+    /// The skeleton table, if any.
+    CountedConstPtrOrConstPtr<ConfigMap> mySkeletonTable;
+    /// The fixed voxels.
+    Image myFixed;
+    /// The extent of the domain.
+    Point myExtent;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// A priority shared by all voxels.
+    struct ConstantPriority
+    {
+      int operator()( const Point & ) const { return 0; }
+    };
+
+    /**
+     * @param p any point of the domain.
+     * @return the subfield of @a p, in [0,8).
+     */
+    unsigned int subfield( const Point & p ) const;
+
+    /**
+     * @param p any voxel of the image.
+     * @param dir a direction in [0,6): -x, +x, -y, +y, -z, +z.
+     * @return 'true' iff the neighbor of @a p in direction @a dir is
+     * out of the object (or of the domain).
+     */
+    bool isBorder( const Point & p, unsigned int dir ) const;
+
+    /**
+     * Performs one subfield pass: removes (or fixes) the voxels of
+     * @a voxels that are border voxels in direction @a dir and simple
+     * (or in the skeleton table).
+     *
+     * @param voxels the indices of voxels of the same subfield.
+     * @param dir a direction in [0,6).
+     * @param[in,out] removed the indices of removed voxels, updated.
+     * @param parallel when 'true', the pass is evaluated in parallel.
+     * @return the number of voxels removed by this pass.
+     */
+    Index pass( const std::vector<Index> & voxels, unsigned int dir,
+               std::vector<Index> & removed, bool parallel );
+
+  }; // end of class SubfieldThinning
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SubfieldThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SubfieldThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const SubfieldThinning<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SubfieldThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SubfieldThinning_h
+
+#undef SubfieldThinning_RECURSES
+#endif // else defined(SubfieldThinning_RECURSES)
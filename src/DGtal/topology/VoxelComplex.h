@@ -187,7 +187,7 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
      */
     template < typename TDigitalSet >
     void construct(const TDigitalSet &input_set,
-                   const Alias<ConfigMap> input_table);
+                   const ConstAlias<ConfigMap> input_table);
 
     /**
      * Set precomputed look up table for simplicity.
@@ -196,7 +196,16 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
      *
      * @see LookUpTableFunctions.h
      */
-    void setSimplicityTable(const Alias<ConfigMap> input_table);
+    void setSimplicityTable(const ConstAlias<ConfigMap> input_table);
+
+    /**
+     * Uses the simplicity table of file name @a tableFilename shared by
+     * the whole process (see functions::loadSharedTable): it is
+     * loaded once, whatever the number of complexes using it.
+     *
+     * @param tableFilename the file name of a table, e.g. simplicity::tableSimple26_6.
+     */
+    void setSimplicityTable(const std::string & tableFilename);
 
     /**
      * Copy table variables from other Complex.
@@ -536,7 +545,7 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
     /*------------- Data --------------*/
   protected:
     /** Look Up Table to speed computations of @ref isSimple. */
-    CountedPtrOrPtr<ConfigMap> myTablePtr;
+    CountedConstPtrOrConstPtr<ConfigMap> myTablePtr;
     /** ConfigurationMask (LUT table). */
     CountedPtrOrPtr<PointToMaskMap> myPointToMaskPtr;
     bool myIsTableLoaded{false}; ///< Flag if using a LUT for simplicity.
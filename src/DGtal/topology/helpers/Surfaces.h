@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <atomic>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/topology/SurfelAdjacency.h"
@@ -161,7 +162,8 @@ namespace DGtal
        PointPredicate. The algorithms tracks surfels along the
        boundary of the shape.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>, or
+       FlatHashCellContainers<KSpace>::SCellSet which is faster).
 
        @tparam PointPredicate a model of concepts::CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -202,7 +204,8 @@ namespace DGtal
        be fully inside the space. Follows the idea of Artzy, Frieder
        and Herman algorithm [Artzy:1981-cgip], but in nD.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>, or
+       FlatHashCellContainers<KSpace>::SCellSet which is faster).
 
        @tparam PointPredicate a model of concepts::CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -240,7 +243,8 @@ namespace DGtal
        boundary component of a digital surface described by a
        SurfelPredicate. The algorithms tracks surfels along the surface.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>, or
+       FlatHashCellContainers<KSpace>::SCellSet which is faster).
 
        @tparam SurfelPredicate a model of CSurfelPredicate describing
        whether a surfel belongs or not to the surface.
@@ -275,7 +279,8 @@ namespace DGtal
        surface. This is an optimized version of trackSurface, which is
        valid only when the tracked surface is closed.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>, or
+       FlatHashCellContainers<KSpace>::SCellSet which is faster).
 
        @tparam SurfelPredicate a model of CSurfelPredicate describing
        whether a surfel belongs or not to the surface.
@@ -623,6 +628,45 @@ namespace DGtal
       const PointPredicate & pp,
       bool forceOrientCellExterior=false );
 
+    /**
+       Labels all the connected components of the boundary of a
+       digital shape described by the predicate [pp], in one sweep.
+
+       The boundary surfels are extracted with sWriteBoundaryParallel
+       and sorted. Then each surfel is united with its neighbors for
+       the given surfel adjacency in a union-find structure (linking
+       the greater root to the smaller one with atomic
+       compare-and-swap, so that the surfels are processed in parallel
+       when DGtal is built with OpenMP support). Components are
+       numbered in the order of their smallest surfel, hence the
+       labelling is deterministic and the components are ordered as in
+       extractAllConnectedSCell. Memory is proportional to the number
+       of boundary surfels.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape, with a thread-safe
+       operator().
+
+       @param[out] bels the sorted vector of all boundary surfels.
+       @param[out] labels for each surfel of @a bels, the index of its
+       component.
+       @param[out] sizes for each component, its number of surfels.
+       @param aKSpace any space.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of concepts::CPointPredicate.
+
+       @return the number of components.
+    */
+    template <typename PointPredicate >
+    static 
+    std::size_t labelAllConnectedSCell
+    ( std::vector<SCell> & bels,
+      std::vector<std::size_t> & labels,
+      std::vector<std::size_t> & sizes,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp );
+
     
     
 
@@ -694,7 +738,8 @@ namespace DGtal
        boundary components of a digital shape described by the predicate
        [pp].
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>, or
+       FlatHashCellContainers<KSpace>::SCellSet which is faster).
        @tparam PointPredicate a model of concepts::CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
        and returning 'true' whenever the point belongs to the shape.
@@ -776,6 +821,95 @@ namespace DGtal
                          const PointPredicate & pp,
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
+
+    /**
+       Writes on the output iterator @a out_it the signed surfels
+       whose elements represents all the boundary elements of a
+       digital shape described by the predicate [pp], exactly in the
+       same order as sWriteBoundary.
+
+       For each direction, the domain is split in slabs along the
+       slowest axis of the traversal of sWriteBoundary. If DGtal is
+       built with OpenMP support (WITH_OPENMP flag), the slabs are
+       processed in parallel, each one writing its surfels in its own
+       vector, and the vectors are then written in the order of the
+       slabs. Otherwise, it is the same as sWriteBoundary.
+
+       @tparam OutputIterator any output iterator (like
+       std::back_insert_iterator< std::vector<SCell> >).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape. It is called
+       concurrently by several threads, hence its operator() must be
+       thread-safe (e.g. a digital set or an image).
+
+       @param out_it any output iterator for writing the signed cells.
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+       @param nbSlabs the number of slabs per direction (0 means four
+       times the number of threads).
+    */
+    template <typename OutputIterator, typename PointPredicate >
+    static 
+    void sWriteBoundaryParallel( OutputIterator & out_it,
+                                 const KSpace & aKSpace,
+                                 const PointPredicate & pp,
+                                 const Point & aLowerBound, 
+                                 const Point & aUpperBound,
+                                 unsigned int nbSlabs = 0 );
+
+    /**
+       Creates a set of signed surfels whose elements represents all the
+       boundary components of a digital shape described by the predicate
+       [pp]. Same result as sMakeBoundary, but the surfels are
+       extracted by sWriteBoundaryParallel, then inserted in the set.
+
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam PointPredicate a model of concepts::CPointPredicate with
+       a thread-safe operator().
+
+       @param aBoundary (modified) a set of cells (which are all surfels),
+       the boundary component of [aSpelSet].
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static 
+    void sMakeBoundaryParallel( SCellSet & aBoundary,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound, 
+                                const Point & aUpperBound  );
+
+    /**
+       Creates a set of unsigned surfels whose elements represents all
+       the boundary components of a digital shape described by the
+       predicate [pp]. Same result as uMakeBoundary, but the surfels
+       are extracted by sWriteBoundaryParallel, then inserted unsigned
+       in the set.
+
+       @tparam CellSet a model of a set of Cell (e.g., std::set<Cell>).
+       @tparam PointPredicate a model of concepts::CPointPredicate with
+       a thread-safe operator().
+
+       @param aBoundary (modified) a set of cells (which are all surfels),
+       the boundary component of [aSpelSet].
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename CellSet, typename PointPredicate >
+    static 
+    void uMakeBoundaryParallel( CellSet & aBoundary,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound, 
+                                const Point & aUpperBound  );
     
 
     
@@ -914,6 +1048,51 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Writes the signed surfels orthogonal to direction @a k in the
+       domain [@a aLowerBound, @a aUpperBound], visited along @a
+       axes. It is one pass of sWriteBoundary.
+
+       @param out_it any output iterator for writing the signed cells.
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the visited spels (a surfel is written between a spel
+       and its predecessor along @a k).
+       @param k the orthogonal direction of the written surfels.
+       @param axes the order of the axes of the traversal, axes[0] == k.
+    */
+    template <typename OutputIterator, typename PointPredicate >
+    static
+    void sWriteBoundaryAlong( OutputIterator & out_it,
+                              const KSpace & aKSpace,
+                              const PointPredicate & pp,
+                              const Point & aLowerBound,
+                              const Point & aUpperBound,
+                              Dimension k,
+                              const std::vector< Dimension > & axes );
+
+    /**
+       Finds the root of @a x in the concurrent union-find structure
+       @a parent, halving the path along the way.
+       @param parent the parent of each element.
+       @param x any element.
+       @return its root, the smallest element of its set.
+    */
+    static std::size_t findRoot( std::vector< std::atomic<std::size_t> > & parent,
+                                 std::size_t x );
+
+    /**
+       Unites the sets of @a x and @a y in the concurrent union-find
+       structure @a parent, the greater root being linked to the
+       smaller one.
+       @param parent the parent of each element.
+       @param x any element.
+       @param y any element.
+    */
+    static void uniteRoots( std::vector< std::atomic<std::size_t> > & parent,
+                            std::size_t x, std::size_t y );
+
   }; // end of class Surfaces
 
 
@@ -0,0 +1,290 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing classes FlatHashSet, FlatHashMap and the
+ * containers of cells given by FlatHashCellContainers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <map>
+#include <string>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/base/FlatHashContainers.h"
+#include "DGtal/base/CSTLAssociativeContainer.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskyCellContainers.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes FlatHashSet and FlatHashMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Identity hash: the table must mix it.
+struct IdentityHash
+{
+  std::size_t operator()( int i ) const { return static_cast<std::size_t>( i ); }
+};
+
+/**
+ * @return 'true' iff the flat set and the std set have the same elements.
+ */
+template <typename FlatSet>
+bool sameSet( const FlatSet & flat, const std::set<int> & ref )
+{
+  if ( flat.size() != ref.size() ) return false;
+  std::size_t n = 0;
+  for ( auto i : flat )
+    {
+      if ( ref.count( i ) == 0 ) return false;
+      ++n;
+    }
+  for ( auto i : ref )
+    if ( flat.count( i ) != 1 ) return false;
+  return n == ref.size();
+}
+
+TEST_CASE( "Testing FlatHashSet" )
+{
+  typedef FlatHashSet<int, IdentityHash> Set;
+  BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< Set > ));
+  REQUIRE( IsSimpleAssociativeContainer< Set >::value );
+  REQUIRE( IsUnorderedAssociativeContainer< Set >::value );
+
+  SECTION("Empty set")
+    {
+      Set s;
+      REQUIRE( s.empty() );
+      REQUIRE( s.begin() == s.end() );
+      REQUIRE( s.find( 3 ) == s.end() );
+      REQUIRE( s.erase( 3 ) == 0 );
+      REQUIRE( s.isValid() );
+    }
+
+  SECTION("Random insertions and erasures")
+    {
+      srand( 0 );
+      Set s;
+      std::set<int> ref;
+      bool ok = true;
+      for ( int n = 0; n < 20000; ++n )
+        {
+          const int i = rand() % 2000;
+          if ( rand() % 3 == 0 )
+            ok = ok && ( s.erase( i ) == ref.erase( i ) );
+          else
+            ok = ok && ( s.insert( i ).second == ref.insert( i ).second );
+        }
+      REQUIRE( ok );
+      REQUIRE( s.isValid() );
+      REQUIRE( sameSet( s, ref ) );
+    }
+
+  SECTION("Erasing while iterating keeps other iterators valid")
+    {
+      Set s;
+      std::set<int> ref;
+      for ( int i = 0; i < 1000; ++i )
+        {
+          s.insert( 7 * i );
+          ref.insert( 7 * i );
+        }
+      for ( auto it = s.begin(); it != s.end(); )
+        if ( *it % 2 == 0 )
+          it = s.erase( it );
+        else
+          ++it;
+      for ( auto it = ref.begin(); it != ref.end(); )
+        if ( *it % 2 == 0 )
+          it = ref.erase( it );
+        else
+          ++it;
+      REQUIRE( sameSet( s, ref ) );
+      s.erase( s.begin(), s.end() );
+      REQUIRE( s.empty() );
+      REQUIRE( s.isValid() );
+    }
+
+  SECTION("Copy, move, equality and rehash")
+    {
+      Set s = { 1, 5, 9, 13, 17 };
+      Set t( s );
+      REQUIRE( s == t );
+      t.erase( 5 );
+      REQUIRE( s != t );
+      t.insert( 5 );
+      t.rehash( 1024 );
+      REQUIRE( t.bucket_count() >= 1024 );
+      REQUIRE( s == t );
+      Set u( std::move( t ) );
+      REQUIRE( t.empty() );
+      REQUIRE( u == s );
+      u.clear();
+      REQUIRE( u.empty() );
+      REQUIRE( u.find( 1 ) == u.end() );
+    }
+}
+
+TEST_CASE( "Testing FlatHashMap" )
+{
+  typedef FlatHashMap<std::string, int> Map;
+  BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< Map > ));
+  REQUIRE( IsPairAssociativeContainer< Map >::value );
+  REQUIRE( IsUnorderedAssociativeContainer< Map >::value );
+
+  srand( 1 );
+  Map m;
+  std::map<std::string, int> ref;
+  for ( int n = 0; n < 5000; ++n )
+    {
+      const std::string key = std::to_string( rand() % 700 );
+      if ( rand() % 4 == 0 )
+        {
+          m.erase( key );
+          ref.erase( key );
+        }
+      else
+        {
+          m[ key ] += n;
+          ref[ key ] += n;
+        }
+    }
+  REQUIRE( m.size() == ref.size() );
+  unsigned int nbok = 0;
+  for ( auto const& p : ref )
+    nbok += ( m.at( p.first ) == p.second ) ? 1 : 0;
+  REQUIRE( nbok == ref.size() );
+  REQUIRE_THROWS_AS( m.at( "not a key" ), std::out_of_range );
+
+  auto ins = m.insert( std::make_pair( std::string( "key" ), 3 ) );
+  REQUIRE( ins.second );
+  REQUIRE( ins.first->second == 3 );
+  ins.first->second = 4;
+  REQUIRE( m[ "key" ] == 4 );
+  REQUIRE( ! m.emplace( "key", 5 ).second );
+  REQUIRE( m.count( "key" ) == 1 );
+  auto range = m.equal_range( "key" );
+  REQUIRE( std::distance( range.first, range.second ) == 1 );
+}
+
+TEST_CASE( "Testing flat hash containers of cells" )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef FlatHashCellContainers<KSpace> Containers;
+  typedef KSpace::SCell SCell;
+
+  Z3i::Point p1( -12, -12, -12 ), p2( 12, 12, 12 );
+  Z3i::Domain domain( p1, p2 );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 0, 0, 0 ), 9 );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 4, 3, 0 ), 7 );
+  KSpace K;
+  K.init( p1, p2, true );
+  SurfelAdjacency<3> SAdj( true );
+
+  SECTION("Packed hash is injective on usual spaces")
+    {
+      KhalimskyCellPackedHash<SCell> h;
+      const SCell s = K.sCell( Z3i::Point( 1, 2, 3 ), true );
+      const SCell t = K.sCell( Z3i::Point( 1, 2, 3 ), false );
+      const SCell u = K.sCell( Z3i::Point( 1, 3, 2 ), true );
+      const SCell v = K.sCell( Z3i::Point( -1, 2, 3 ), true );
+      REQUIRE( h( s ) != h( t ) );
+      REQUIRE( h( s ) != h( u ) );
+      REQUIRE( h( s ) != h( v ) );
+    }
+
+  SECTION("Boundaries and tracking give the same cells as std::set")
+    {
+      std::set<SCell> refBdry;
+      Containers::SCellSet bdry;
+      Surfaces<KSpace>::sMakeBoundary( refBdry, K, set, p1, p2 );
+      Surfaces<KSpace>::sMakeBoundary( bdry, K, set, p1, p2 );
+      REQUIRE( bdry.size() == refBdry.size() );
+
+      const SCell bel = Surfaces<KSpace>::findABel( K, set, 10000 );
+      std::set<SCell> refSurface;
+      Containers::SurfelSet surface;
+      Surfaces<KSpace>::trackBoundary( refSurface, K, SAdj, set, bel );
+      Surfaces<KSpace>::trackBoundary( surface, K, SAdj, set, bel );
+      REQUIRE( surface.size() == refSurface.size() );
+      unsigned int nbok = 0;
+      for ( auto const& s : refSurface )
+        nbok += surface.count( s );
+      REQUIRE( nbok == refSurface.size() );
+
+      typedef SetOfSurfels< KSpace, Containers::SurfelSet > Container;
+      DigitalSurface<Container> digSurf( new Container( K, SAdj, surface ) );
+      REQUIRE( digSurf.size() == refSurface.size() );
+      unsigned int nbEdges = 0;
+      for ( auto const& s : digSurf )
+        nbEdges += digSurf.degree( s );
+      REQUIRE( nbEdges == 4 * refSurface.size() );
+    }
+
+  SECTION("Cubical complexes give the same cells as with std::map")
+    {
+      typedef CubicalComplex< KSpace > RefCC;
+      typedef CubicalComplex< KSpace, Containers::CellMap<CubicalCellData>::Type > CC;
+      RefCC refComplex( K );
+      CC complex( K );
+      for ( auto const& p : set )
+        {
+          refComplex.insertCell( K.uSpel( p ) );
+          complex.insertCell( K.uSpel( p ) );
+        }
+      refComplex.close();
+      complex.close();
+      for ( Dimension d = 0; d <= 3; ++d )
+        REQUIRE( complex.nbCells( d ) == refComplex.nbCells( d ) );
+      RefCC refBdry = refComplex.boundary();
+      CC bdry = complex.boundary();
+      for ( Dimension d = 0; d <= 3; ++d )
+        REQUIRE( bdry.nbCells( d ) == refBdry.nbCells( d ) );
+      CC interior( K ), boundary( K );
+      complex.getInteriorAndBoundary( interior, boundary );
+      REQUIRE( boundary.nbCells( 2 ) == refBdry.nbCells( 2 ) );
+      REQUIRE( interior.nbCells( 3 ) == complex.nbCells( 3 ) );
+      REQUIRE( interior.nbCells( 2 ) + boundary.nbCells( 2 ) == complex.nbCells( 2 ) );
+      unsigned int nbok = 0;
+      for ( auto it = refBdry.begin( 1 ), itE = refBdry.end( 1 ); it != itE; ++it )
+        nbok += bdry.belongs( it->first ) ? 1 : 0;
+      REQUIRE( nbok == refBdry.nbCells( 1 ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
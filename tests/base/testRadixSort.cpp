@@ -0,0 +1,110 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing function radixSortByKey.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/base/RadixSort.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing function radixSortByKey.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef std::pair< DGtal::uint64_t, unsigned int > Item;
+
+/// Compares keys only, as the radix sort does.
+struct KeyLess
+{
+  bool operator()( const Item & a, const Item & b ) const { return a.first < b.first; }
+};
+
+/**
+ * @return 'true' iff the radix sort of \a items gives the same
+ * sequence as a stable sort by keys.
+ */
+bool sameAsStableSort( std::vector< Item > items, bool parallel )
+{
+  std::vector< Item > ref = items;
+  std::stable_sort( ref.begin(), ref.end(), KeyLess() );
+  functions::radixSortByKey( items, parallel );
+  return items == ref;
+}
+
+TEST_CASE( "Testing radixSortByKey" )
+{
+  srand( 0 );
+  std::vector< Item > items( 200000 );
+
+  SECTION( "Packed pairs of indices, with many duplicated keys" )
+    {
+      const DGtal::uint64_t n = 1000;
+      for ( unsigned int i = 0; i < items.size(); ++i )
+        items[ i ] = Item( DGtal::uint64_t( rand() % n ) * n + DGtal::uint64_t( rand() % n ), i );
+      REQUIRE( sameAsStableSort( items, false ) );
+      REQUIRE( sameAsStableSort( items, true ) );
+    }
+
+  SECTION( "Full 64 bits keys" )
+    {
+      for ( unsigned int i = 0; i < items.size(); ++i )
+        items[ i ] = Item( ( DGtal::uint64_t( rand() ) << 40 ) ^ ( DGtal::uint64_t( rand() ) << 20 )
+                           ^ DGtal::uint64_t( rand() ), i );
+      REQUIRE( sameAsStableSort( items, false ) );
+      REQUIRE( sameAsStableSort( items, true ) );
+    }
+
+  SECTION( "Keys sharing their low digits" )
+    {
+      for ( unsigned int i = 0; i < items.size(); ++i )
+        items[ i ] = Item( DGtal::uint64_t( rand() % 100 ) << 33, i );
+      REQUIRE( sameAsStableSort( items, true ) );
+    }
+
+  SECTION( "Small sequences" )
+    {
+      std::vector< Item > small;
+      functions::radixSortByKey( small );
+      REQUIRE( small.empty() );
+      small.push_back( Item( 3, 0 ) );
+      small.push_back( Item( 0, 1 ) );
+      small.push_back( Item( 3, 2 ) );
+      small.push_back( Item( 0, 3 ) );
+      REQUIRE( sameAsStableSort( small, false ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
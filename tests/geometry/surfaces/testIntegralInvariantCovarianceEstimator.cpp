@@ -275,13 +275,123 @@ bool testPrincipalCurvatures3d( double h )
   return true;
 }
 
+bool testRangeEvaluation3d( double h )
+{
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef MyDigitalSurface::ConstIterator SurfelConstIterator;
+
+  typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space> MyIICurvatureFunctor;
+  typedef IntegralInvariantCovarianceEstimator< Z3i::KSpace, DigitalShape, MyIICurvatureFunctor > MyIICurvatureEstimator;
+  typedef MyIICurvatureFunctor::Value Value;
+
+  double re = 3.0;
+
+  trace.beginBlock( "Range evaluation (chunks, Morton order) against surfel evaluation ..." );
+
+  ImplicitShape ishape( Z3i::RealPoint( 0, 0, 0 ), 6.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -10.0, -10.0, -10.0 ), Z3i::RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Z3i::KSpace::Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  MyIICurvatureFunctor curvatureFunctor;
+  curvatureFunctor.init( h, re );
+
+  MyIICurvatureEstimator curvatureEstimator( curvatureFunctor );
+  curvatureEstimator.attach( K, dshape );
+  curvatureEstimator.setParams( re/h );
+  curvatureEstimator.init( h, surf.begin(), surf.end() );
+
+  std::vector< Value > results;
+  std::back_insert_iterator< std::vector< Value > > resultsIt( results );
+  curvatureEstimator.eval( surf.begin(), surf.end(), resultsIt );
+
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  for ( SurfelConstIterator it = surf.begin(), itend = surf.end(); it != itend && nb < results.size(); ++it, ++nb )
+  {
+    nbok += ( std::abs( curvatureEstimator.eval( it ) - results[ nb ] ) < 1e-10 ) ? 1 : 0;
+  }
+
+  trace.info() << nbok << "/" << surf.size() << " surfels with the same curvature" << std::endl;
+  trace.endBlock();
+  return nbok == surf.size() && results.size() == surf.size();
+}
+
+bool testPrefixSums3d( double h, double re )
+{
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+
+  typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space> MyIICurvatureFunctor;
+  typedef IntegralInvariantCovarianceEstimator< Z3i::KSpace, DigitalShape, MyIICurvatureFunctor > MyIICurvatureEstimator;
+  typedef MyIICurvatureFunctor::Value Value;
+
+  trace.beginBlock( "Prefix sums against masks ..." );
+
+  ImplicitShape ishape( Z3i::RealPoint( 0, 0, 0 ), 6.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -10.0, -10.0, -10.0 ), Z3i::RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Z3i::KSpace::Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  MyIICurvatureFunctor curvatureFunctor;
+  curvatureFunctor.init( h, re );
+
+  std::vector< Value > masks, prefixSums;
+  for ( unsigned int i = 0; i < 2; ++i )
+  {
+    MyIICurvatureEstimator curvatureEstimator( curvatureFunctor );
+    curvatureEstimator.attach( K, dshape );
+    curvatureEstimator.setParams( re/h, i == 1 );
+    curvatureEstimator.init( h, surf.begin(), surf.end() );
+    curvatureEstimator.eval( surf.begin(), surf.end(), std::back_inserter( i == 0 ? masks : prefixSums ) );
+  }
+
+  unsigned int nbok = 0;
+  for ( unsigned int i = 0; i < masks.size() && i < prefixSums.size(); ++i )
+    nbok += ( std::abs( masks[ i ] - prefixSums[ i ] ) < 1e-6 ) ? 1 : 0;
+
+  trace.info() << nbok << "/" << masks.size() << " surfels with the same curvature" << std::endl;
+  trace.endBlock();
+  return nbok == masks.size() && masks.size() == prefixSums.size() && ! masks.empty();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegralInvariantCovarianceEstimator and 3d functors" );
-    bool res = testGaussianCurvature3d( 0.6, 0.007 ) && testPrincipalCurvatures3d( 0.6 );
+    bool res = testGaussianCurvature3d( 0.6, 0.007 ) && testPrincipalCurvatures3d( 0.6 )
+      && testRangeEvaluation3d( 0.5 ) && testPrefixSums3d( 0.5, 3.1 )
+      // lattice points on the kernel sphere (digital radius 6)
+      && testPrefixSums3d( 0.5, 3.0 );
     trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
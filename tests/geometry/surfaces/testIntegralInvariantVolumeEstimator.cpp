@@ -261,13 +261,167 @@ bool testMeanCurvature3d( double h, double delta )
   return true;
 }
 
+/**
+ * Compares the prefix sums backend with the masks one. When lattice
+ * points lie exactly on the kernel sphere, the grid step should be a
+ * dyadic number, otherwise the shifted masks may round them
+ * differently (see testPrefixSumsOnSphere).
+ */
+template <typename KSpace, typename MyIIFunctor>
+bool testPrefixSums( double h, double re )
+{
+  typedef typename KSpace::Space Space;
+  typedef typename Space::RealPoint RealPoint;
+  typedef ImplicitBall<Space> ImplicitShape;
+  typedef GaussDigitizer<Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+
+  typedef IntegralInvariantVolumeEstimator< KSpace, DigitalShape, MyIIFunctor > MyIIEstimator;
+  typedef typename MyIIFunctor::Value Value;
+
+  trace.beginBlock( "Prefix sums against masks ..." );
+
+  ImplicitShape ishape( RealPoint::zero, 5.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint::diagonal( -7.0 ), RealPoint::diagonal( 7.0 ), h );
+
+  KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  typename KSpace::Surfel bel = Surfaces<KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  MyIIFunctor functor;
+  functor.init( h, re );
+
+  std::vector< Value > masks, prefixSums;
+  for ( unsigned int i = 0; i < 2; ++i )
+  {
+    VisitorRange range( new Visitor( surf, *surf.begin() ));
+    MyIIEstimator estimator( functor );
+    estimator.attach( K, dshape );
+    estimator.setParams( re/h, i == 1 );
+    estimator.init( h, range.begin(), range.end() );
+    estimator.eval( range.begin(), range.end(), std::back_inserter( i == 0 ? masks : prefixSums ) );
+  }
+
+  unsigned int nbok = 0;
+  for ( unsigned int i = 0; i < masks.size() && i < prefixSums.size(); ++i )
+    nbok += ( masks[ i ] == prefixSums[ i ] ) ? 1 : 0;
+
+  trace.info() << nbok << "/" << masks.size() << " equal volumes" << std::endl;
+  trace.endBlock();
+  return nbok == masks.size() && masks.size() == prefixSums.size() && ! masks.empty();
+}
+
+/**
+ * Checks the prefix sums backend against a brute-force count of the
+ * points of the digital kernel in the shape, at the inner and outer
+ * spels of each surfel. With a digital radius re/h that is an integer
+ * and a step h that is not a dyadic number (e.g. 0.1), lattice points
+ * lie exactly on the kernel sphere and the masks backend may differ
+ * (reported, not checked).
+ */
+template <typename KSpace, typename MyIIFunctor>
+bool testPrefixSumsOnSphere( double h, double re )
+{
+  typedef typename KSpace::Space Space;
+  typedef typename Space::Point Point;
+  typedef typename Space::RealPoint RealPoint;
+  typedef ImplicitBall<Space> ImplicitShape;
+  typedef GaussDigitizer<Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef typename MyDigitalSurface::ConstIterator SurfelConstIterator;
+
+  typedef IntegralInvariantVolumeEstimator< KSpace, DigitalShape, MyIIFunctor > MyIIEstimator;
+  typedef typename MyIIFunctor::Value Value;
+
+  trace.beginBlock( "Prefix sums with lattice points on the kernel sphere ..." );
+
+  ImplicitShape ishape( RealPoint::zero, 5.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint::diagonal( -7.0 ), RealPoint::diagonal( 7.0 ), h );
+
+  KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  typename KSpace::Surfel bel = Surfaces<KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  MyIIFunctor functor;
+  functor.init( h, re );
+
+  std::vector< Value > masks, prefixSums;
+  for ( unsigned int i = 0; i < 2; ++i )
+  {
+    MyIIEstimator estimator( functor );
+    estimator.attach( K, dshape );
+    estimator.setParams( re/h, i == 1 );
+    estimator.init( h, surf.begin(), surf.end() );
+    estimator.eval( surf.begin(), surf.end(), std::back_inserter( i == 0 ? masks : prefixSums ) );
+  }
+
+  // The digital kernel, as built by the estimator.
+  ImplicitShape ball( RealPoint::zero, re );
+  DigitalShape kernel;
+  kernel.attach( ball );
+  kernel.init( ball.getLowerBound() + Point::diagonal( -1 ), ball.getUpperBound() + Point::diagonal( 1 ), h );
+  std::vector< Point > kernelPoints;
+  for ( auto const & p : kernel.getDomain() )
+    if ( kernel( p ) ) kernelPoints.push_back( p );
+
+  unsigned int nbok = 0, nbSameAsMasks = 0, i = 0;
+  for ( SurfelConstIterator it = surf.begin(), itend = surf.end(); it != itend; ++it, ++i )
+  {
+    const Dimension k = K.sOrthDir( *it );
+    double volume = 0.0;
+    for ( auto const & spel : { K.sDirectIncident( *it, k ), K.sIndirectIncident( *it, k ) } )
+      for ( auto const & p : kernelPoints )
+      {
+        const Point q = K.sCoords( spel ) + p;
+        if ( q.isLower( K.upperBound() ) && q.isUpper( K.lowerBound() ) && dshape( q ) )
+          volume += 0.5;
+      }
+    nbok += ( std::abs( functor( volume ) - prefixSums[ i ] ) < 1e-12 ) ? 1 : 0;
+    nbSameAsMasks += ( masks[ i ] == prefixSums[ i ] ) ? 1 : 0;
+  }
+
+  trace.info() << nbok << "/" << prefixSums.size() << " exact volumes, "
+               << nbSameAsMasks << " equal to the masks ones" << std::endl;
+  trace.endBlock();
+  return nbok == prefixSums.size() && ! prefixSums.empty();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegralInvariantVolumeEstimator and 2d/3d mean curvature functors" );
-    bool res = testCurvature2d( 0.05, 0.002 ) && testMeanCurvature3d( 0.6, 0.008 );
+    bool res = testCurvature2d( 0.05, 0.002 ) && testMeanCurvature3d( 0.6, 0.008 )
+      && testPrefixSums< Z2i::KSpace, functors::IICurvatureFunctor<Z2i::Space> >( 0.1, 3.05 )
+      && testPrefixSums< Z3i::KSpace, functors::IIMeanCurvature3DFunctor<Z3i::Space> >( 0.4, 3.0 )
+      // lattice points on the kernel sphere (digital radii 12 and 10)
+      && testPrefixSums< Z2i::KSpace, functors::IICurvatureFunctor<Z2i::Space> >( 0.25, 3.0 )
+      && testPrefixSums< Z3i::KSpace, functors::IIMeanCurvature3DFunctor<Z3i::Space> >( 0.25, 2.5 )
+      && testPrefixSumsOnSphere< Z2i::KSpace, functors::IICurvatureFunctor<Z2i::Space> >( 0.1, 3.0 )
+      && testPrefixSumsOnSphere< Z3i::KSpace, functors::IIMeanCurvature3DFunctor<Z3i::Space> >( 0.2, 2.0 );
     trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
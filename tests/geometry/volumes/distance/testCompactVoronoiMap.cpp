@@ -0,0 +1,145 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class CompactVoronoiMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/CompactVoronoiMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CompactVoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing CompactVoronoiMap" )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 3> L3Metric;
+  typedef CompactVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> CompactVoro;
+
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< CompactVoro > ));
+
+  Z3i::Point a( -2, 0, 1 );
+  Z3i::Point b( 30, 11, 9 );
+  Z3i::Domain domain( a, b );
+
+  srand( 0 );
+  Z3i::DigitalSet set( domain );
+  set.assignFromComplement( Z3i::DigitalSet( domain ) );
+  for ( unsigned int i = 0; i < 20; ++i )
+    set.erase( Z3i::Point( rand() % (b[0] - a[0] + 1) + a[0],
+                           rand() % (b[1] - a[1] + 1) + a[1],
+                           rand() % (b[2] - a[2] + 1) + a[2] ) );
+
+  L2Metric l2;
+  L3Metric l3;
+
+  SECTION("Sites are the ones of VoronoiMap")
+    {
+      VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> voro( domain, set, l2 );
+      CompactVoro compact( domain, set, l2 );
+      unsigned int nbok = 0;
+      for ( auto const & pt : domain )
+        nbok += ( voro( pt ) == compact( pt ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+
+      VoronoiMap<Z3i::Space, Z3i::DigitalSet, L3Metric> voro3( domain, set, l3 );
+      CompactVoronoiMap<Z3i::Space, Z3i::DigitalSet, L3Metric> compact3( domain, set, l3 );
+      nbok = 0;
+      for ( auto const & pt : domain )
+        nbok += ( voro3( pt ) == compact3( pt ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+    }
+
+  SECTION("Distances written into scalar images")
+    {
+      DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> dt( domain, set, l2 );
+      CompactVoro compact( domain, set, l2 );
+
+      ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> rawImage( domain );
+      ImageContainerBySTLVector<Z3i::Domain, double> image( domain );
+      compact.rawDistances( rawImage );
+      compact.distances( image );
+
+      unsigned int nbok = 0;
+      for ( auto const & pt : domain )
+        {
+          const Z3i::Vector v = dt.getVoronoiVector( pt ) - pt;
+          const DGtal::uint64_t squared = v.dot( v );
+          nbok += ( rawImage( pt ) == squared && image( pt ) == Approx( dt( pt ) ) ) ? 1 : 0;
+        }
+      REQUIRE( nbok == domain.size() );
+    }
+
+  SECTION("Domain without sites")
+    {
+      Z3i::DigitalSet full( domain );
+      full.assignFromComplement( Z3i::DigitalSet( domain ) );
+      CompactVoro compact( domain, full, l2 );
+      REQUIRE( compact.siteIndex( a ) == CompactVoro::NoSite );
+
+      ImageContainerBySTLVector<Z3i::Domain, double> image( domain );
+      compact.distances( image, -1.0 );
+      REQUIRE( image( b ) == -1.0 );
+    }
+
+  SECTION("Site indices must fit into the SiteIndex type")
+    {
+      typedef CompactVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, DGtal::uint8_t> TinyVoro;
+      typedef CompactVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, DGtal::uint64_t> LargeVoro;
+      // 255 points: the indices 0..254 fit, 255 is NoSite.
+      const Z3i::Domain small( Z3i::Point( 0, 0, 0 ), Z3i::Point( 4, 2, 16 ) );
+      Z3i::DigitalSet smallSet( small );
+      smallSet.assignFromComplement( Z3i::DigitalSet( small ) );
+      smallSet.erase( Z3i::Point( 1, 2, 3 ) );
+      smallSet.erase( Z3i::Point( 4, 0, 15 ) );
+      TinyVoro tiny( small, smallSet, l2 );
+      LargeVoro large( small, smallSet, l2 );
+      VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> voro( small, smallSet, l2 );
+      unsigned int nbok = 0;
+      for ( auto const & pt : small )
+        nbok += ( voro( pt ) == tiny( pt ) && voro( pt ) == large( pt ) ) ? 1 : 0;
+      REQUIRE( nbok == small.size() );
+      // 256 points do not fit into 8-bit indices.
+      const Z3i::Domain tooLarge( Z3i::Point( 0, 0, 0 ), Z3i::Point( 3, 3, 15 ) );
+      Z3i::DigitalSet tooLargeSet( tooLarge );
+      REQUIRE_THROWS_AS( TinyVoro( tooLarge, tooLargeSet, l2 ), std::length_error );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,320 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class FIM.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/FIM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FIM.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes distance values with FMM and FIM from the same initial
+ * points and returns the max absolute difference (or -1 if the two
+ * sets of points differ).
+ *
+ * @param aDomain a domain.
+ * @param aSources source points with their values.
+ * @param aThreshold value threshold.
+ */
+template <typename TDomain,
+          template <typename, typename> class TPointFunctor>
+double compareFMMAndFIM( const TDomain & aDomain,
+                         const std::vector< std::pair<typename TDomain::Point, double> > & aSources,
+                         double aThreshold )
+{
+  typedef ImageContainerBySTLVector<TDomain, double> Image;
+  typedef DigitalSetBySTLSet<TDomain> Set;
+  typedef functors::DomainPredicate<TDomain> Predicate;
+  typedef TPointFunctor<Image, Set> Distance;
+
+  Predicate predicate( aDomain );
+  Image img1( aDomain ), img2( aDomain );
+  Set set1( aDomain ), set2( aDomain );
+  for ( auto const & s : aSources )
+    {
+      img1.setValue( s.first, s.second ); set1.insert( s.first );
+      img2.setValue( s.first, s.second ); set2.insert( s.first );
+    }
+
+  FMM<Image, Set, Predicate, Distance> fmm( img1, set1, predicate,
+                                             aDomain.size() + 1, aThreshold );
+  fmm.compute();
+  FIM<Image, Set, Predicate, Distance> fim( img2, set2, predicate, aThreshold );
+  fim.compute();
+  trace.info() << fmm << std::endl;
+  trace.info() << fim << std::endl;
+  if ( ! fim.isValid() || set1.size() != set2.size() )
+    return -1.0;
+
+  double maxError = 0.0;
+  for ( auto const & p : set1 )
+    {
+      if ( set2.find( p ) == set2.end() )
+        return -1.0;
+      maxError = std::max( maxError, std::abs( img1( p ) - img2( p ) ) );
+    }
+  return maxError;
+}
+
+/**
+ * Computes distance values from sources of null value with FMM or
+ * FIM and returns the max absolute difference with the Euclidean
+ * distance to the closest source.
+ *
+ * @param aDomain a domain.
+ * @param aSources source points.
+ * @param aFlagIsFIM 'true' to use FIM, 'false' to use FMM.
+ */
+template <typename TDomain,
+          template <typename, typename> class TPointFunctor>
+double maxErrorToSources( const TDomain & aDomain,
+                          const std::vector<typename TDomain::Point> & aSources,
+                          bool aFlagIsFIM )
+{
+  typedef ImageContainerBySTLVector<TDomain, double> Image;
+  typedef DigitalSetBySTLSet<TDomain> Set;
+  typedef functors::DomainPredicate<TDomain> Predicate;
+  typedef TPointFunctor<Image, Set> Distance;
+
+  Predicate predicate( aDomain );
+  Image img( aDomain );
+  Set set( aDomain );
+  for ( auto const & s : aSources )
+    {
+      img.setValue( s, 0.0 ); set.insert( s );
+    }
+  if ( aFlagIsFIM )
+    {
+      FIM<Image, Set, Predicate, Distance> fim( img, set, predicate );
+      fim.compute();
+    }
+  else
+    {
+      FMM<Image, Set, Predicate, Distance> fmm( img, set, predicate );
+      fmm.compute();
+    }
+
+  double maxError = 0.0;
+  for ( auto const & p : aDomain )
+    {
+      double d = std::numeric_limits<double>::max();
+      for ( auto const & s : aSources )
+        d = std::min( d, ( p - s ).norm() );
+      maxError = std::max( maxError, std::abs( img( p ) - d ) );
+    }
+  return maxError;
+}
+
+TEST_CASE( "Testing FIM against FMM" )
+{
+  typedef Z2i::Point Point2;
+  typedef Z3i::Point Point3;
+  typedef std::pair<Point2, double> Source2;
+  typedef std::pair<Point3, double> Source3;
+
+  const Z2i::Domain domain2( Point2( -20, -15 ), Point2( 25, 20 ) );
+  const std::vector<Source2> sources2 = { Source2( Point2( 0, 0 ), 0.0 ),
+                                          Source2( Point2( 12, -7 ), 0.0 ),
+                                          Source2( Point2( -15, 10 ), 0.0 ) };
+  const Z3i::Domain domain3( Point3::diagonal( -10 ), Point3::diagonal( 10 ) );
+  const std::vector<Source3> sources3 = { Source3( Point3( 0, 0, 0 ), 0.0 ),
+                                          Source3( Point3( 5, -7, 3 ), 0.0 ) };
+
+  SECTION("L2 first order")
+    {
+      REQUIRE( compareFMMAndFIM<Z2i::Domain, L2FirstOrderLocalDistance>
+               ( domain2, sources2, 1000.0 ) == Approx( 0.0 ).margin( 1e-4 ) );
+      REQUIRE( compareFMMAndFIM<Z3i::Domain, L2FirstOrderLocalDistance>
+               ( domain3, sources3, 1000.0 ) == Approx( 0.0 ).margin( 1e-4 ) );
+    }
+  SECTION("L2 second order")
+    {
+      //the second-order scheme depends on the order of the updates:
+      //FIM and FMM results are compared to the Euclidean distance
+      std::vector<Point2> points2;
+      for ( auto const & s : sources2 )
+        points2.push_back( s.first );
+      const double errorFMM1 = maxErrorToSources<Z2i::Domain, L2FirstOrderLocalDistance>
+        ( domain2, points2, false );
+      const double errorFMM2 = maxErrorToSources<Z2i::Domain, L2SecondOrderLocalDistance>
+        ( domain2, points2, false );
+      const double errorFIM2 = maxErrorToSources<Z2i::Domain, L2SecondOrderLocalDistance>
+        ( domain2, points2, true );
+      trace.info() << "max errors: " << errorFMM1 << " (FMM, first order) "
+                   << errorFMM2 << " (FMM, second order) "
+                   << errorFIM2 << " (FIM, second order)" << std::endl;
+      REQUIRE( errorFIM2 < errorFMM1 );
+      REQUIRE( errorFIM2 < 2 * errorFMM2 );
+    }
+  SECTION("L1 and Linf")
+    {
+      REQUIRE( compareFMMAndFIM<Z3i::Domain, L1LocalDistance>
+               ( domain3, sources3, 1000.0 ) == Approx( 0.0 ).margin( 1e-4 ) );
+      REQUIRE( compareFMMAndFIM<Z3i::Domain, LInfLocalDistance>
+               ( domain3, sources3, 1000.0 ) == Approx( 0.0 ).margin( 1e-4 ) );
+    }
+  SECTION("Value threshold")
+    {
+      REQUIRE( compareFMMAndFIM<Z2i::Domain, L2FirstOrderLocalDistance>
+               ( domain2, sources2, 7.5 ) == Approx( 0.0 ).margin( 1e-4 ) );
+    }
+}
+
+TEST_CASE( "Testing FIM on a signed distance" )
+{
+  typedef ImplicitBall<Z3i::Space> Ball;
+  typedef GaussDigitizer<Z3i::Space, Ball> Digitizer;
+  typedef ImageContainerBySTLMap<Z3i::Domain, double> Image;
+  typedef DigitalSetFromMap<Image> Set;
+  typedef functors::DomainPredicate<Z3i::Domain> Predicate;
+
+  Ball ball( Z3i::RealPoint( 0, 0, 0 ), 7.3 );
+  Digitizer digitizer;
+  digitizer.attach( ball );
+  digitizer.init( Z3i::RealPoint::diagonal( -12 ), Z3i::RealPoint::diagonal( 12 ), 1 );
+  const Z3i::Domain domain = digitizer.getDomain();
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  Z3i::KSpace::SCellSet boundary;
+  Surfaces<Z3i::KSpace>::sMakeBoundary( boundary, K, digitizer,
+                                        domain.lowerBound(), domain.upperBound() );
+  Predicate predicate( domain );
+
+  Image img1( domain ), img2( domain );
+  Set set1( img1 ), set2( img2 );
+  FMM<Image, Set, Predicate>::initFromBelsRange( K, boundary.begin(), boundary.end(),
+                                                 img1, set1, 0.5 );
+  FMM<Image, Set, Predicate>::initFromBelsRange( K, boundary.begin(), boundary.end(),
+                                                 img2, set2, 0.5 );
+
+  FMM<Image, Set, Predicate> fmm( img1, set1, predicate );
+  fmm.compute();
+  FIM<Image, Set, Predicate> fim( img2, set2, predicate );
+  fim.compute();
+  trace.info() << fim << std::endl;
+
+  REQUIRE( fim.isValid() );
+  REQUIRE( set2.size() == domain.size() );
+  REQUIRE( fim.min() == Approx( fmm.min() ).margin( 1e-4 ) );
+  REQUIRE( fim.max() == Approx( fmm.max() ).margin( 1e-4 ) );
+  unsigned int nbok = 0;
+  for ( auto const & p : domain )
+    nbok += ( std::abs( img1( p ) - img2( p ) ) < 1e-4 ) ? 1 : 0;
+  REQUIRE( nbok == domain.size() );
+}
+
+TEST_CASE( "Testing FIM with several threads" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> Image;
+  typedef DigitalSetBySTLSet<Z3i::Domain> Set;
+  typedef functors::DomainPredicate<Z3i::Domain> Predicate;
+  typedef Z3i::Point Point;
+
+  const Z3i::Domain domain( Point::diagonal( -20 ), Point::diagonal( 20 ) );
+  const std::vector<Point> sources = { Point( 0, 0, 0 ), Point( 9, -12, 5 ) };
+  Predicate predicate( domain );
+
+  Image ref( domain );
+  Set refSet( domain );
+  for ( auto const & s : sources )
+    {
+      ref.setValue( s, 0.0 ); refSet.insert( s );
+    }
+  FMM<Image, Set, Predicate> fmm( ref, refSet, predicate );
+  fmm.compute();
+
+#ifdef WITH_OPENMP
+  const int maxNbThreads = omp_get_max_threads();
+  const std::vector<int> nbThreads = { 1, 2, 4, std::max( maxNbThreads, 8 ) };
+#else
+  const std::vector<int> nbThreads = { 1 };
+#endif
+  std::vector<Image> images;
+  for ( int n : nbThreads )
+    {
+#ifdef WITH_OPENMP
+      omp_set_num_threads( n );
+#endif
+      Image img( domain );
+      Set set( domain );
+      for ( auto const & s : sources )
+        {
+          img.setValue( s, 0.0 ); set.insert( s );
+        }
+      trace.beginBlock( "FIM with " + std::to_string( n ) + " threads" );
+      FIM<Image, Set, Predicate> fim( img, set, predicate );
+      fim.compute();
+      trace.info() << fim << std::endl;
+      trace.endBlock();
+      REQUIRE( set.size() == domain.size() );
+      images.push_back( img );
+    }
+#ifdef WITH_OPENMP
+  omp_set_num_threads( maxNbThreads );
+#endif
+
+  //the result does not depend on the number of threads
+  //and matches FMM
+  for ( auto const & img : images )
+    {
+      unsigned int nbSame = 0, nbok = 0;
+      for ( auto const & p : domain )
+        {
+          nbSame += ( img( p ) == images[ 0 ]( p ) ) ? 1 : 0;
+          nbok += ( std::abs( img( p ) - ref( p ) ) < 1e-4 ) ? 1 : 0;
+        }
+      REQUIRE( nbSame == domain.size() );
+      REQUIRE( nbok == domain.size() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -653,6 +653,65 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Comparison of the candidate queues:
+ * the indexed heap must give the same result as the
+ * default set, the untidy queue a close one.
+ */
+bool testCandidateQueues(int size)
+{
+  static const DGtal::Dimension dimension = 3; 
+
+  //Domain
+  typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+  typedef Domain::Point Point; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+  DomainPredicate<Domain> dp(d);
+
+  //Images and sets
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain> Set; 
+  Image map1( d ), map2( d ), map3( d ); 
+  Set set1( d ), set2( d ), set3( d );
+  //two sources
+  const Point p( -size/2, 0, 1 ), q( size/3, 2, -size/4 );
+  for ( auto const & pt : { p, q } )
+    {
+      map1.setValue( pt, 0.0 ); set1.insert( pt );
+      map2.setValue( pt, 0.0 ); set2.insert( pt );
+      map3.setValue( pt, 0.0 ); set3.insert( pt );
+    }
+
+  trace.beginBlock ( "Candidate queues comparison " );
+
+  typedef L2FirstOrderLocalDistance<Image, Set> Distance;
+  FMM<Image, Set, DomainPredicate<Domain>, Distance, FMMSetCandidateQueue> fmm1( map1, set1, dp );
+  FMM<Image, Set, DomainPredicate<Domain>, Distance, FMMIndexedHeapCandidateQueue> fmm2( map2, set2, dp );
+  FMM<Image, Set, DomainPredicate<Domain>, Distance, FMMUntidyCandidateQueue> fmm3( map3, set3, dp );
+  fmm1.compute();
+  fmm2.compute();
+  fmm3.compute();
+  trace.info() << fmm1 << std::endl; 
+  trace.info() << fmm2 << std::endl; 
+  trace.info() << fmm3 << std::endl; 
+
+  bool flagIsOk = ( set1.size() == d.size() )
+    && ( set2.size() == d.size() )
+    && ( set3.size() == d.size() );
+  double maxError = 0.0;
+  for ( auto const & pt : d )
+    {
+      flagIsOk = flagIsOk && ( map1( pt ) == map2( pt ) );
+      maxError = std::max( maxError, std::abs( map1( pt ) - map3( pt ) ) );
+    }
+  trace.info() << "untidy queue max error: " << maxError << std::endl;
+  flagIsOk = flagIsOk && ( maxError < 0.1 );
+
+  trace.endBlock();
+
+  return flagIsOk; 
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -681,6 +740,11 @@ int main ( int argc, char** argv )
   res = res && testDisplayDT3d( size, area, std::sqrt(size*size*size) )
     ; 
 
+  //3d L2 candidate queues
+  size = 15;
+  res = res && testCandidateQueues( size )
+    ;
+
   //3d L1 and  comparison
   size = 20; 
   area = int( std::pow(double(2*size+1),3) )+1; 
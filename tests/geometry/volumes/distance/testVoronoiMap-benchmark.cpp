@@ -0,0 +1,135 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoronoiMap-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the L2 VoronoiMap on large 3D domains.
+ *
+ * Usage: testVoronoiMap-benchmark [size (default 256)]
+ *
+ * The timings of the line-by-line passes are obtained by building
+ * this file against the VoronoiMap headers preceding the
+ * cache-blocked passes (the checksums are the same). On a single
+ * core (gcc 12, -O3 -DNDEBUG, several alternate runs), the whole map
+ * goes:
+ * - for size 512, from about 32s to 8s for the ball (x4.0) and from
+ *   35s to 7.5s for the sparse sites (x4.7);
+ * - for size 256, from about 3.9s to 1.4s for the ball (x2.8) and
+ *   from 3.7s to 1.3s for the sparse sites (x2.8), the x3 target
+ *   being only reached on the largest domains.
+ *
+ * The timings vary a lot from one run to the other on a loaded
+ * machine: old and new versions should be run alternately.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class VoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Points inside a ball (the sites are the points outside).
+struct BallPredicate
+{
+  typedef Z3i::Point Point;
+  BallPredicate( Point::Component aRadius = 0 ) : myRadius( aRadius ) {}
+  bool operator()( const Point & p ) const
+  {
+    return p.dot( p ) <= myRadius * myRadius;
+  }
+  Point::Component myRadius;
+};
+
+/// All points but a sparse pseudo-random set of sites (about 1/1000).
+struct SparseSitesPredicate
+{
+  typedef Z3i::Point Point;
+  bool operator()( const Point & p ) const
+  {
+    const unsigned int h = ( static_cast<unsigned int>( p[0] ) * 73856093u )
+      ^ ( static_cast<unsigned int>( p[1] ) * 19349663u )
+      ^ ( static_cast<unsigned int>( p[2] ) * 83492791u );
+    return ( h % 1000u ) != 0;
+  }
+};
+
+/**
+ * Computes the L2 Voronoi map of a predicate.
+ *
+ * @param aName name of the run.
+ * @param aDomain the domain.
+ * @param aPredicate the predicate.
+ * @return a checksum of the map.
+ */
+template <typename Predicate>
+double run( const std::string & aName, const Z3i::Domain & aDomain,
+            const Predicate & aPredicate )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef VoronoiMap<Z3i::Space, Predicate, L2Metric> Voronoi;
+  L2Metric l2;
+
+  trace.beginBlock( aName );
+  Voronoi voronoi( aDomain, aPredicate, l2 );
+  const double duration = trace.endBlock();
+
+  double sum = 0.0;
+  for ( auto const & p : aDomain )
+    sum += l2( p, voronoi( p ) );
+  trace.info() << aName << ": " << duration << " ms, checksum " << sum << std::endl;
+  return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class VoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const Z3i::Point::Component size = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 256;
+  const Z3i::Domain domain( Z3i::Point::diagonal( -size / 2 ),
+                            Z3i::Point::diagonal( -size / 2 + size - 1 ) );
+
+  const bool res = ( run( "L2 ball", domain, BallPredicate( size / 2 - 2 ) ) > 0.0 )
+    && ( run( "L2 sparse sites", domain, SparseSitesPredicate() ) > 0.0 );
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -647,6 +647,53 @@ bool testSimpleRandom3D()
 }
 
 
+/** Image container for which the cache-blocked pass of VoronoiMap
+ * uses the generic (operator() and setValue based) tile accessor.
+ */
+struct GenericAccessImage
+  : public ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector>
+{
+  using ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector>::ImageContainerBySTLVector;
+};
+
+/** Cache-blocked pass on a domain which width is not a multiple of
+ * the tile width, with both the direct memory and the generic tile
+ * accessors.
+ */
+bool testTiledPass3D()
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> Voro;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, GenericAccessImage> VoroMap;
+
+  Z3i::Point a(-3, 2, 0);
+  Z3i::Point b(35, 9, 6);
+  Z3i::Domain domain(a,b);
+
+  Z3i::DigitalSet sites(domain);
+  for(unsigned int i = 0 ; i < 12; ++i)
+    sites.insert( Z3i::Point( rand() % (b[0] - a[0] + 1) + a[0],
+                              rand() % (b[1] - a[1] + 1) + a[1],
+                              rand() % (b[2] - a[2] + 1) + a[2] ) );
+
+  Z3i::DigitalSet set(domain);
+  for ( auto const & pt : domain )
+    if ( ! sites(pt) )
+      set.insertNew( pt );
+
+  L2Metric l2;
+  trace.beginBlock( "Tiled pass 3D" );
+  Voro voro( domain, set, l2 );
+  VoroMap voroMap( domain, set, l2 );
+
+  bool ok = checkVoronoi( sites, voro );
+  for ( auto const & pt : domain )
+    ok = ok && ( voro(pt) == voroMap(pt) );
+  trace.info() << "Identical outputs: " << ok << std::endl;
+  trace.endBlock();
+
+  return ok;
+}
 
 bool testSimple4D()
 {
@@ -695,6 +742,7 @@ int main( int argc, char** argv )
     && testSimpleRandom2D()
     && testSimple3D()
     && testSimpleRandom3D()
+    && testTiledPass3D()
     && testSimple4D()
     ; // && ... other tests
 
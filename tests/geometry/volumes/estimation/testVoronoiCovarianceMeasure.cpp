@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <vector>
+#include <map>
+#include <iterator>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/estimation/VoronoiCovarianceMeasure.h"
@@ -106,6 +108,77 @@ bool testVoronoiCovarianceMeasure()
   return nbok == nb;
 }
 
+/**
+ * Checks the flat storage of the VCM against a direct accumulation
+ * over the Voronoi map, and the measure of a range of points against
+ * the measure at each point.
+ */
+bool testFlatStorage()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  using namespace DGtal;
+  using namespace DGtal::Z3i; // gets Space, Point, Domain
+  trace.beginBlock ( "testFlatStorage" );
+  typedef ExactPredicateLpSeparableMetric<Space,2> Metric;
+  typedef VoronoiCovarianceMeasure<Space, Metric> VCM;
+  typedef VCM::MatrixNN Matrix;
+
+  // A digital sphere, with a duplicated point.
+  std::vector<Point> pts;
+  Domain sphereDomain( Point::diagonal( -10 ), Point::diagonal( 10 ) );
+  for ( Domain::ConstIterator it = sphereDomain.begin(), itE = sphereDomain.end(); it != itE; ++it )
+    if ( std::abs( (*it).norm() - 8.0 ) < 0.5 ) pts.push_back( *it );
+  pts.push_back( pts.front() );
+  Metric l2;
+  const double R = 3.0;
+  VCM vcm( R, 3.0, l2, false );
+  vcm.init( pts.begin(), pts.end() );
+  nbok += ( vcm.vcmPoints().size() + 1 == pts.size()
+            && vcm.vcmMatrices().size() == vcm.vcmPoints().size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << vcm.vcmPoints().size() << " distinct points" << std::endl;
+
+  std::map<Point,Matrix> reference;
+  Domain d = vcm.domain();
+  for ( Domain::ConstIterator it = d.begin(), itE = d.end(); it != itE; ++it )
+    {
+      Point q = vcm.voronoiMap()( *it );
+      if ( q != *it && l2( q, *it ) <= R )
+        {
+          Matrix m;
+          for ( Dimension i = 0; i < 3; ++i )
+            for ( Dimension j = 0; j < 3; ++j )
+              m.setComponent( i, j, double( (*it - q)[ i ] ) * double( (*it - q)[ j ] ) );
+          reference[ q ] += m;
+        }
+    }
+  const VCM::Point2MatrixNN vcmMap = vcm.vcmMap();
+  unsigned int nbequal = 0;
+  for ( VCM::Point2MatrixNN::const_iterator it = vcmMap.begin(), itE = vcmMap.end(); it != itE; ++it )
+    nbequal += ( it->second == reference[ it->first ] ) ? 1 : 0;
+  nbok += ( nbequal == vcm.vcmPoints().size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbequal << " VCM equal to the direct accumulation" << std::endl;
+
+  functors::HatPointFunction< Point, double > chi_r( 1.0, 3.0 );
+  std::vector<Matrix> measures;
+  vcm.measure( chi_r, vcm.vcmPoints().begin(), vcm.vcmPoints().end(), std::back_inserter( measures ) );
+  nbequal = 0;
+  for ( unsigned int i = 0; i < measures.size(); ++i )
+    nbequal += ( measures[ i ] == vcm.measure( chi_r, vcm.vcmPoints()[ i ] ) ) ? 1 : 0;
+  nbok += ( nbequal == vcm.vcmPoints().size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbequal << " measures of the range equal to the measure at each point" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -114,7 +187,7 @@ int main( int /* argc */, char** /* argv */ )
   using namespace std;
   using namespace DGtal;
   trace.beginBlock ( "Testing VoronoiCovarianceMeasure ..." );
-  bool res = testVoronoiCovarianceMeasure();
+  bool res = testVoronoiCovarianceMeasure() && testFlatStorage();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
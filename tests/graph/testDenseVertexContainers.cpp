@@ -0,0 +1,165 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes DenseVertexSet and DenseVertexMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <map>
+#include <cstdlib>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/graph/CVertexMap.h"
+#include "DGtal/graph/DenseVertexContainers.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes DenseVertexSet and DenseVertexMap.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DGtal::uint32_t                        Vertex;
+typedef DenseVertexSet< Vertex >               VertexSet;
+typedef DenseVertexMap< Vertex, double >       VertexMap;
+BOOST_CONCEPT_ASSERT(( concepts::CVertexMap< VertexMap > ));
+
+TEST_CASE( "Testing DenseVertexSet" )
+{
+  srand( 0 );
+  VertexSet      set;
+  std::set<Vertex> ref;
+  for ( int i = 0; i < 2000; ++i )
+    {
+      const Vertex v = rand() % 5000;
+      REQUIRE( set.insert( v ).second == ref.insert( v ).second );
+    }
+  for ( int i = 0; i < 500; ++i )
+    {
+      const Vertex v = rand() % 5000;
+      REQUIRE( set.erase( v ) == ref.erase( v ) );
+    }
+  SECTION( "Same vertices as a std::set, in the same order" )
+    {
+      REQUIRE( set.isValid() );
+      REQUIRE( set.size() == ref.size() );
+      REQUIRE( std::vector<Vertex>( set.begin(), set.end() )
+               == std::vector<Vertex>( ref.begin(), ref.end() ) );
+      for ( Vertex v = 0; v < 6000; ++v )
+        REQUIRE( ( set.find( v ) == set.end() ) == ( ref.find( v ) == ref.end() ) );
+    }
+  SECTION( "Erasing by iterators and clearing" )
+    {
+      VertexSet other( set );
+      REQUIRE( other == set );
+      for ( auto it = other.begin(); it != other.end(); )
+        it = ( *it % 2 == 0 ) ? other.erase( it ) : std::next( it );
+      for ( Vertex v : other ) REQUIRE( v % 2 == 1 );
+      REQUIRE( other != set );
+      other.clear();
+      REQUIRE( other.empty() );
+      REQUIRE( other.begin() == other.end() );
+    }
+}
+
+TEST_CASE( "Testing DenseVertexMap" )
+{
+  srand( 0 );
+  VertexMap map;
+  std::map<Vertex, double> ref;
+  for ( int i = 0; i < 2000; ++i )
+    {
+      const Vertex v = rand() % 5000;
+      map[ v ] += 1.0;
+      ref[ v ] += 1.0;
+    }
+  REQUIRE( map.insert( std::make_pair( Vertex( 7000 ), 3.0 ) ).second );
+  REQUIRE( ! map.insert( std::make_pair( Vertex( 7000 ), 4.0 ) ).second );
+  ref[ 7000 ] = 3.0;
+  map.erase( 10 ); ref.erase( 10 );
+  SECTION( "Same pairs as a std::map, in the same order" )
+    {
+      REQUIRE( map.isValid() );
+      REQUIRE( map.size() == ref.size() );
+      auto rit = ref.begin();
+      for ( auto it = map.begin(), itE = map.end(); it != itE; ++it, ++rit )
+        {
+          REQUIRE( it->first  == rit->first );
+          REQUIRE( it->second == rit->second );
+        }
+      REQUIRE( map( 7000 ) == 3.0 );
+    }
+  SECTION( "Values are modified through iterators and setValue" )
+    {
+      for ( auto it = map.begin(), itE = map.end(); it != itE; ++it )
+        it->second *= 2.0;
+      map.setValue( 1, 5.0 );
+      const VertexMap& cmap = map;
+      REQUIRE( cmap.find( 1 )->second == 5.0 );
+      REQUIRE( cmap.at( 7000 ) == 6.0 );
+      REQUIRE( cmap.count( 10 ) == 0 );
+      REQUIRE( cmap.find( 10 ) == cmap.end() );
+    }
+  SECTION( "Iterators are forward iterators on std::pair<const Vertex, Value>" )
+    {
+      typedef std::iterator_traits<VertexMap::iterator>       Traits;
+      typedef std::iterator_traits<VertexMap::const_iterator> ConstTraits;
+      REQUIRE( ( std::is_same< Traits::value_type, std::pair<const Vertex, double> >::value ) );
+      REQUIRE( ( std::is_same< Traits::reference, Traits::value_type& >::value ) );
+      REQUIRE( ( std::is_same< ConstTraits::reference, const ConstTraits::value_type& >::value ) );
+      for ( auto & kv : map ) kv.second += 1.0;
+      auto rit = ref.begin();
+      for ( const auto & kv : map )
+        {
+          REQUIRE( kv.first  == rit->first );
+          REQUIRE( kv.second == rit->second + 1.0 );
+          ++rit;
+        }
+      REQUIRE( &*map.find( 7000 ) == &*map.find( 7000 ) );
+      REQUIRE( std::distance( map.begin(), map.end() ) == (std::ptrdiff_t) ref.size() );
+    }
+  SECTION( "Copies have the same pairs" )
+    {
+      VertexMap other( 10 );
+      other[ 3 ] = 1.0;
+      other = map;
+      REQUIRE( other.isValid() );
+      REQUIRE( std::equal( other.begin(), other.end(), ref.begin() ) );
+      other.clear();
+      REQUIRE( other.empty() );
+      REQUIRE( other[ 7000 ] == 0.0 );
+      REQUIRE( map( 7000 ) == 3.0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -93,14 +93,11 @@ static void BM_SetValue(benchmark::State& state)
       typename Q::Domain dom(typename Q::Point().diagonal(0),
                              typename Q::Point().diagonal(state.range(0)));
       Q image( dom );
+      state.ResumeTiming();
       for(typename std::set<typename Q::Point>::const_iterator it = data.begin(), itend=data.end();
           it != itend; ++it)
-        {
-          state.ResumeTiming();
-          image.setValue( *it , 42);
-          state.PauseTiming();
-          cpt++;
-        }
+        image.setValue( *it , 42);
+      cpt += data.size();
     }
   // const int64_t items_processed =
     // static_cast<int64_t>(state.iterations())*state.range(0);
@@ -110,6 +107,31 @@ BENCHMARK_TEMPLATE(BM_SetValue, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_SetValue, ImageMap2)->Range(1<<3 , 1 << 16);
 BENCHMARK_TEMPLATE(BM_SetValue, ImageHash2)->Range(1<<3 , 1 << 10);
 
+template<typename Q>
+static void BM_GetValue(benchmark::State& state)
+{
+  std::set<typename Q::Point> data = ConstructRandomSet<typename Q::Point>(state.range(0),state.range(0));
+  typename Q::Domain dom(typename Q::Point().diagonal(0),
+                         typename Q::Point().diagonal(state.range(0)));
+  Q image( dom );
+  for(typename std::set<typename Q::Point>::const_iterator it = data.begin(), itend=data.end();
+      it != itend; ++it)
+    image.setValue( *it , 42);
+  int64_t cpt=0;
+  int sum=0;
+  while (state.KeepRunning())
+    {
+      for(typename std::set<typename Q::Point>::const_iterator it = data.begin(), itend=data.end();
+          it != itend; ++it)
+        benchmark::DoNotOptimize(sum += image( *it ));
+      cpt += data.size();
+    }
+  state.SetItemsProcessed(cpt);
+}
+BENCHMARK_TEMPLATE(BM_GetValue, ImageVector2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_GetValue, ImageMap2)->Range(1<<3 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_GetValue, ImageHash2)->Range(1<<3 , 1 << 10);
+
 template<typename Q>
 static void BM_RangeScan(benchmark::State& state)
 {
@@ -44,6 +44,10 @@
 
 #include "DGtal/helpers/StdDefs.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace DGtal;
@@ -273,6 +277,82 @@ bool testBadKeySizes()
   return true;  
 }
 
+/**
+ * Builds a sparse labelled 3D image, then hash trees from this image
+ * by buildFromImage and by concurrent calls to concurrentSetValue,
+ * and checks that they give the same values.
+ */
+bool testBuildAndConcurrentSetValue()
+{
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef ImageContainerBySTLVector<Domain, int> DenseImage;
+  typedef experimental::ImageContainerByHashTree<Domain, int> Image;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Domain domain( Point( -10, -5, 0 ), Point( 53, 58, 63 ) );
+  DenseImage dense( domain );
+  srand( 0 );
+  for ( unsigned int i = 0; i < 20; ++i )
+    {
+      const Point c( rand() % 64 - 10, rand() % 64 - 5, rand() % 64 );
+      const int r = 2 + rand() % 6;
+      for ( auto const& p : Domain( c - Point::diagonal( r ), c + Point::diagonal( r ) ) )
+        if ( domain.isInside( p ) && ( p - c ).squaredNorm() <= r * r )
+          dense.setValue( p, i + 1 );
+    }
+  std::vector<Point> points( domain.begin(), domain.end() );
+
+  trace.beginBlock( "Morton-ordered construction from a dense image" );
+  Image built( domain );
+  built.buildFromImage( dense );
+  for ( auto const& p : domain )
+    nbok += ( built( p ) == dense( p ) ) ? 1 : 0;
+  nb += domain.size();
+  unsigned int nbIterated = 0;
+  for ( Image::Iterator it = built.begin(); it != built.end(); ++it )
+    nbIterated++;
+  nbok += ( nbIterated == built.getNbNodes() ) ? 1 : 0;
+  nb++;
+  trace.info() << built << std::endl;
+  trace.info() << "(" << nbok << "/" << nb << ") values" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Concurrent setValue" );
+  Image concurrent( domain );
+  concurrent.setValue( points[ 0 ], 7 );
+  concurrent.startConcurrentSetValue( 16 );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+  for ( int i = 0; i < (int) points.size(); ++i )
+    concurrent.concurrentSetValue( points[ i ], dense( points[ i ] ) );
+  concurrent.endConcurrentSetValue();
+  for ( auto const& p : domain )
+    nbok += ( concurrent( p ) == dense( p ) ) ? 1 : 0;
+  nb += domain.size();
+  // Writes after the concurrent ones use the stripes as well.
+  concurrent.setValue( points[ 10 ], 100 );
+  nbok += ( concurrent( points[ 10 ] ) == 100 ) ? 1 : 0;
+  nbok += ( concurrent( points[ 11 ] ) == dense( points[ 11 ] ) ) ? 1 : 0;
+  nb += 2;
+  trace.info() << concurrent << std::endl;
+  trace.info() << "(" << nbok << "/" << nb << ") values" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Nodes removal in the open addressing table" );
+  Image small( Domain( Point::zero, Point::diagonal( 15 ) ), 2 );
+  for ( unsigned int i = 0; i < 5000; ++i )
+    small.setValue( Point( rand() % 16, rand() % 16, rand() % 16 ), rand() % 2 );
+  nbok += small.checkIntegrity() ? 1 : 0;
+  nb++;
+  trace.info() << small << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -284,7 +364,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << std::endl;
 
-  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes()
+    && testBuildAndConcurrentSetValue();  // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,233 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ImageContainerByBitVector.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBitVector.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBitVector.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fills randomly a bit image and a set with @a percent of the points
+ * of @a domain.
+ */
+template <typename Domain, typename DigitalSet>
+void fillRandomly( ImageContainerByBitVector<Domain> & image,
+                   DigitalSet & set, const Domain & domain, int percent )
+{
+  for ( auto const& p : domain )
+    if ( rand() % 100 < percent )
+      {
+        image.setValue( p, true );
+        set.insertNew( p );
+      }
+}
+
+/**
+ * Checks the configurations and the simplicity given by the image
+ * against the ones given by the object.
+ * @return the number of failures.
+ */
+template <typename Object, typename Image>
+unsigned int checkConfigurations( const Object & object, const Image & image,
+                                  const std::string & table )
+{
+  typedef typename Object::Point Point;
+  auto map = functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  auto simple = functions::loadTable( table );
+  unsigned int nbfail = 0;
+  for ( auto const& p : image.domain() )
+    {
+      const NeighborhoodConfiguration cfg = image.getNeighborhoodConfiguration( p );
+      nbfail += ( cfg == object.getNeighborhoodConfigurationOccupancy( p, *map ) ) ? 0 : 1;
+      if ( image( p ) )
+        nbfail += ( (*simple)[ cfg ] == object.isSimple( p ) ) ? 0 : 1;
+    }
+  return nbfail;
+}
+
+TEST_CASE( "Testing ImageContainerByBitVector" )
+{
+  typedef ImageContainerByBitVector<Z3i::Domain> BitImage;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< BitImage > ));
+  srand( 0 );
+  Z3i::Domain domain( Z3i::Point( -3, -2, 1 ), Z3i::Point( 126, 5, 6 ) );
+  BitImage image( domain );
+  ImageContainerBySTLVector<Z3i::Domain, bool> ref( domain );
+  for ( auto const& p : domain )
+    {
+      const bool v = rand() % 3 == 0;
+      image.setValue( p, v );
+      ref.setValue( p, v );
+    }
+
+  SECTION( "Values and words" )
+    {
+      REQUIRE( image.isValid() );
+      REQUIRE( image.nbWordsPerRow() == 3 );
+      unsigned int nbok = 0, nbtrue = 0;
+      for ( auto const& p : domain )
+        {
+          nbok   += ( image( p ) == ref( p ) ) ? 1 : 0;
+          nbtrue += ref( p ) ? 1 : 0;
+        }
+      REQUIRE( nbok == domain.size() );
+      REQUIRE( image.count() == nbtrue );
+      REQUIRE( std::count( image.constRange().begin(), image.constRange().end(), true )
+               == nbtrue );
+      const Z3i::Point p( 70, 1, 3 );
+      const BitImage::Word* row = image.rowWords( p );
+      REQUIRE( ( ( row[ 1 ] >> ( 70 + 3 - 64 ) ) & 1 ) == ( image( p ) ? 1u : 0u ) );
+      BitImage::Word* wrow = image.rowWords( p );
+      wrow[ 0 ] = ~BitImage::Word( 0 );
+      REQUIRE( image( Z3i::Point( -3, 1, 3 ) ) );
+      REQUIRE( image( Z3i::Point( 60, 1, 3 ) ) );
+      image.fill( true );
+      REQUIRE( image.count() == domain.size() );
+      image.fill( false );
+      REQUIRE( image.count() == 0 );
+    }
+}
+
+TEST_CASE( "Testing neighborhood configurations of ImageContainerByBitVector" )
+{
+  srand( 0 );
+  SECTION( "3D configurations and simplicity" )
+    {
+      typedef Z3i::Domain Domain;
+      Domain domain( Z3i::Point( 60, -2, 0 ), Z3i::Point( 69, 3, 4 ) );
+      ImageContainerByBitVector<Domain> image( domain );
+      Z3i::DigitalSet set( domain );
+      fillRandomly( image, set, domain, 40 );
+      Z3i::Object26_6 object( Z3i::dt26_6, set );
+      REQUIRE( checkConfigurations( object, image, simplicity::tableSimple26_6 ) == 0 );
+    }
+  SECTION( "3D configurations across words" )
+    {
+      typedef Z3i::Domain Domain;
+      Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 129, 2, 2 ) );
+      ImageContainerByBitVector<Domain> image( domain );
+      Z3i::DigitalSet set( domain );
+      fillRandomly( image, set, domain, 50 );
+      Z3i::Object6_26 object( Z3i::dt6_26, set );
+      REQUIRE( checkConfigurations( object, image, simplicity::tableSimple6_26 ) == 0 );
+    }
+  SECTION( "2D configurations and simplicity" )
+    {
+      typedef Z2i::Domain Domain;
+      Domain domain( Z2i::Point( -40, -5 ), Z2i::Point( 40, 5 ) );
+      ImageContainerByBitVector<Domain> image( domain );
+      Z2i::DigitalSet set( domain );
+      fillRandomly( image, set, domain, 50 );
+      Z2i::Object8_4 object( Z2i::dt8_4, set );
+      REQUIRE( checkConfigurations( object, image, simplicity::tableSimple8_4 ) == 0 );
+    }
+}
+
+/**
+ * Checks the simple points computed word by word against the
+ * simplicity of each point.
+ * @return the number of failures.
+ */
+template <typename Image>
+unsigned int checkSimplePoints( const Image & image, const boost::dynamic_bitset<> & table )
+{
+  const Image simple    = image.getSimplePoints( table );
+  const Image simplePar = image.getSimplePoints( table, true );
+  unsigned int nbfail = 0;
+  for ( auto const& p : image.domain() )
+    {
+      const bool expected = image( p ) && table[ image.getNeighborhoodConfiguration( p ) ];
+      nbfail += ( simple( p ) == expected ) ? 0 : 1;
+      nbfail += ( simplePar( p ) == expected ) ? 0 : 1;
+    }
+  return nbfail;
+}
+
+TEST_CASE( "Testing simple points of ImageContainerByBitVector" )
+{
+  srand( 0 );
+  SECTION( "3D simple points across words" )
+    {
+      typedef Z3i::Domain Domain;
+      Domain domain( Z3i::Point( 0, -2, 0 ), Z3i::Point( 129, 3, 4 ) );
+      ImageContainerByBitVector<Domain> image( domain );
+      Z3i::DigitalSet set( domain );
+      fillRandomly( image, set, domain, 60 );
+      auto table = functions::loadTable( simplicity::tableSimple26_6 );
+      REQUIRE( checkSimplePoints( image, *table ) == 0 );
+      Z3i::Object26_6 object( Z3i::dt26_6, set );
+      const ImageContainerByBitVector<Domain> simple = image.getSimplePoints( *table );
+      unsigned int nbfail = 0;
+      for ( auto const& p : set )
+        nbfail += ( simple( p ) == object.isSimple( p ) ) ? 0 : 1;
+      REQUIRE( nbfail == 0 );
+    }
+  SECTION( "3D block of 8x8x8 points" )
+    {
+      typedef Z3i::Domain Domain;
+      Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 7, 7, 7 ) );
+      ImageContainerByBitVector<Domain> image( domain );
+      image.fill( true );
+      auto table = functions::loadTable( simplicity::tableSimple26_6 );
+      REQUIRE( checkSimplePoints( image, *table ) == 0 );
+      // All the border points of a full cube are simple.
+      REQUIRE( image.getSimplePoints( *table ).count() == 8 * 8 * 8 - 6 * 6 * 6 );
+      image.setValue( Z3i::Point( 3, 3, 3 ), false );
+      image.setValue( Z3i::Point( 5, 2, 6 ), false );
+      REQUIRE( checkSimplePoints( image, *table ) == 0 );
+    }
+  SECTION( "2D simple points" )
+    {
+      typedef Z2i::Domain Domain;
+      Domain domain( Z2i::Point( -40, -5 ), Z2i::Point( 40, 5 ) );
+      ImageContainerByBitVector<Domain> image( domain );
+      Z2i::DigitalSet set( domain );
+      fillRandomly( image, set, domain, 60 );
+      auto table = functions::loadTable<2>( simplicity::tableSimple8_4 );
+      REQUIRE( checkSimplePoints( image, *table ) == 0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
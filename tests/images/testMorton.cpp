@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/images/Morton.h"
@@ -120,6 +122,70 @@ bool testMorton()
   return nbok == nb;
 }
 
+/**
+ * Reference interleaving of the bits of a point, bit per bit.
+ */
+template <typename HashKey, typename Point>
+HashKey referenceKey( const std::size_t treeDepth, const Point & p )
+{
+  const unsigned int coordSize = ( sizeof( HashKey ) * 8 ) / Point::dimension;
+  HashKey key = 0;
+  for ( unsigned int i = 0; i < coordSize; ++i )
+    for ( unsigned int n = 0; n < Point::dimension; ++n )
+      if ( static_cast<HashKey>( p[ n ] ) & ( static_cast<HashKey>( 1 ) << i ) )
+        key |= static_cast<HashKey>( 1 ) << ( i * Point::dimension + n );
+  return key | ( static_cast<HashKey>( 1 ) << ( Point::dimension * treeDepth ) );
+}
+
+/**
+ * Compares the keys and the coordinates computed by Morton with the
+ * reference ones, for random points of [0,2^treeDepth[^n, with and
+ * without BMI2.
+ */
+template <typename HashKey, typename Point>
+bool testMortonDilation( const std::size_t treeDepth )
+{
+  typedef Morton<HashKey, Point> M;
+  M morton;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Testing Morton dilation, dim=" + std::to_string( Point::dimension )
+                    + " key bits=" + std::to_string( sizeof( HashKey ) * 8 ) );
+  std::vector<Point> points;
+  for ( unsigned int k = 0; k < 1000; ++k )
+    {
+      Point p;
+      for ( Dimension i = 0; i < Point::dimension; ++i )
+        p[ i ] = static_cast<typename Point::Coordinate>
+          ( ( ( DGtal::uint64_t( rand() ) << 31 ) ^ DGtal::uint64_t( rand() ) )
+            % ( DGtal::uint64_t( 1 ) << treeDepth ) );
+      points.push_back( p );
+    }
+  points.push_back( Point::diagonal( ( DGtal::uint64_t( 1 ) << treeDepth ) - 1 ) );
+  const bool bmi2 = M::useBMI2();
+  trace.info() << "BMI2 available: " << bmi2 << std::endl;
+  for ( int pass = 0; pass < 2; ++pass )
+    {
+      M::setUseBMI2( pass == 0 );
+      std::vector<HashKey> keys( points.size() );
+      morton.keysFromCoordinates( treeDepth, points.begin(), points.end(), keys.begin() );
+      for ( unsigned int k = 0; k < points.size(); ++k )
+        {
+          const HashKey ref = referenceKey<HashKey>( treeDepth, points[ k ] );
+          Point q;
+          morton.coordinatesFromKey( ref, q );
+          nbok += ( morton.keyFromCoordinates( treeDepth, points[ k ] ) == ref ) ? 1 : 0;
+          nbok += ( keys[ k ] == ref ) ? 1 : 0;
+          nbok += ( q == points[ k ] ) ? 1 : 0;
+          nb += 3;
+        }
+    }
+  M::setUseBMI2( true );
+  trace.info() << "(" << nbok << "/" << nb << ") keys and coordinates" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -131,7 +197,13 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMorton(); // && ... other tests
+  bool res = testMorton()
+    && testMortonDilation< DGtal::uint32_t, PointVector<2, DGtal::int32_t> >( 15 )
+    && testMortonDilation< DGtal::uint64_t, PointVector<2, DGtal::int64_t> >( 31 )
+    && testMortonDilation< DGtal::uint32_t, PointVector<3, DGtal::int32_t> >( 10 )
+    && testMortonDilation< DGtal::uint64_t, PointVector<3, DGtal::int32_t> >( 20 )
+    && testMortonDilation< DGtal::uint64_t, PointVector<4, DGtal::int32_t> >( 15 )
+    && testMortonDilation< DGtal::uint16_t, PointVector<2, DGtal::int32_t> >( 7 );
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -29,11 +29,19 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageFactoryAsync.h"
 #include "DGtal/images/TiledImage.h"
 
 #include "ConfigTest.h"
@@ -327,6 +335,220 @@ bool test_range_constRange()
     return nbok == nb;
 }
 
+bool testLRUPrefetchAndConcurrentRead()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing TiledImage with a LRU cache, prefetch and concurrent reads");
+
+    typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+    VImage image(Z3i::Domain(Z3i::Point(0,0,0), Z3i::Point(31,31,31)));
+
+    int i = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // tiles of 8x8x8 ints, room for 3 tiles
+    const std::size_t tileBytes = 8*8*8*sizeof(int);
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryFromImage, 3*tileBytes);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWT> MyTiledImage;
+    BOOST_CONCEPT_ASSERT(( concepts::CImage< MyTiledImage > ));
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWT, 4);
+
+    // LRU: tile 0 is used again before loading tiles 2 and 3, so tile 1 is detached
+    tiledImage(Z3i::Point(0,0,0)); tiledImage(Z3i::Point(8,0,0)); tiledImage(Z3i::Point(1,0,0));
+    tiledImage(Z3i::Point(16,0,0)); tiledImage(Z3i::Point(24,0,0));
+    nbok += (tiledImage.getCacheMissRead() == 4) ? 1 : 0; nb++;
+    tiledImage(Z3i::Point(2,0,0));
+    nbok += (tiledImage.getCacheMissRead() == 4) ? 1 : 0; nb++;
+    tiledImage(Z3i::Point(9,0,0));
+    nbok += (tiledImage.getCacheMissRead() == 5) ? 1 : 0; nb++;
+    nbok += (imageCacheReadPolicyLRU.usedBytes() == 3*tileBytes) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") LRU order" << endl;
+
+    // prefetch: a forward then a backward scan only miss the first tile
+    tiledImage.clearCacheAndResetCacheMisses();
+    tiledImage.setPrefetch(2);
+    std::vector<int> values;
+    for (MyTiledImage::ConstIterator it = tiledImage.begin(), itend = tiledImage.end(); it != itend; ++it)
+      values.push_back(*it);
+    std::vector<int> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+    bool ok = sorted.size() == image.domain().size();
+    for (unsigned int k = 0; ok && k < sorted.size(); k++)
+      ok = (sorted[k] == (int)k);
+    nbok += ok ? 1 : 0; nb++;
+    nbok += (tiledImage.getCacheMissRead() == 1) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") forward scan, misses: " << tiledImage.getCacheMissRead() << endl;
+
+    tiledImage.clearCacheAndResetCacheMisses();
+    MyTiledImage::ConstIterator it = tiledImage.end();
+    ok = true;
+    for (unsigned int k = values.size(); ok && k > 0; k--)
+      ok = (*(--it) == values[k-1]);
+    nbok += ok ? 1 : 0; nb++;
+    nbok += (tiledImage.getCacheMissRead() == 1) ? 1 : 0; nb++;
+    nbok += (imageCacheReadPolicyLRU.usedBytes() <= 3*tileBytes) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") backward scan, misses: " << tiledImage.getCacheMissRead() << endl;
+
+    // concurrent reads with a sharded cache
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyShards(imageFactoryFromImage, 16*tileBytes, 8);
+    MyTiledImage tiledImage2(imageFactoryFromImage, imageCacheReadPolicyShards, imageCacheWritePolicyWT, 4);
+    std::vector<Z3i::Point> points;
+    for (int k = 0; k < 20000; k++)
+      points.push_back(Z3i::Point(rand() % 32, rand() % 32, rand() % 32));
+    unsigned int nbErrors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 64) reduction(+:nbErrors)
+#endif
+    for (int k = 0; k < (int)points.size(); k++)
+      nbErrors += (tiledImage2.concurrentRead(points[k]) == image(points[k])) ? 0 : 1;
+    nbok += (nbErrors == 0) ? 1 : 0; nb++;
+    nbok += (imageCacheReadPolicyShards.usedBytes() <= 16*tileBytes) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") concurrent reads, misses: " << tiledImage2.getCacheMissRead() << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+/**
+ * Image factory counting its requests, which are blocked until the
+ * gate is opened.
+ */
+class GatedImageFactory : public ImageFactoryFromImage< ImageContainerBySTLVector<Z3i::Domain, int> >
+{
+public:
+    typedef ImageFactoryFromImage< ImageContainerBySTLVector<Z3i::Domain, int> > Base;
+
+    GatedImageFactory(ImageContainer & anImage): Base(anImage), myNbRequests(0), myOpen(false) {}
+
+    OutputImage * requestImage(const Domain &aDomain)
+    {
+        {
+            std::unique_lock<std::mutex> lock(myMutex);
+            myCondition.wait(lock, [this] { return myOpen; });
+            ++myNbRequests;
+        }
+        return Base::requestImage(aDomain);
+    }
+
+    void openGate()
+    {
+        {
+            std::lock_guard<std::mutex> lock(myMutex);
+            myOpen = true;
+        }
+        myCondition.notify_all();
+    }
+
+    unsigned int getNbRequests()
+    {
+        std::lock_guard<std::mutex> lock(myMutex);
+        return myNbRequests;
+    }
+
+private:
+    unsigned int myNbRequests;
+    bool myOpen;
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+};
+
+bool testAsyncFactory()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing TiledImage with an asynchronous factory");
+
+    typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+    VImage image(Z3i::Domain(Z3i::Point(0,0,0), Z3i::Point(31,31,31)));
+
+    int i = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef ImageFactoryAsync<MyImageFactoryFromImage> MyImageFactoryAsync;
+    typedef MyImageFactoryAsync::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+    MyImageFactoryAsync imageFactoryAsync(imageFactoryFromImage, 4);
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory< MyImageFactoryAsync > ));
+
+    // a prefetched image is produced in the background
+    Z3i::Domain d(Z3i::Point(8,8,8), Z3i::Point(15,15,15));
+    imageFactoryAsync.prefetchImage(d);
+    imageFactoryAsync.wait();
+    OutputImage *page = imageFactoryAsync.requestImage(d);
+    nbok += (imageFactoryAsync.getNbPrefetchHits() == 1 && (*page)(Z3i::Point(9,8,8)) == image(Z3i::Point(9,8,8))) ? 1 : 0; nb++;
+    imageFactoryAsync.detachImage(page);
+    trace.info() << "(" << nbok << "/" << nb << ") prefetch " << imageFactoryAsync << endl;
+
+    // an image waited by requestImage is not detached by the following prefetches
+    {
+        GatedImageFactory gatedFactory(image);
+        ImageFactoryAsync<GatedImageFactory> gatedFactoryAsync(gatedFactory, 1);
+        for (int k = 0; k < 4; k++)
+            gatedFactoryAsync.prefetchImage(Z3i::Domain(Z3i::Point(8*k,0,0), Z3i::Point(8*k+7,7,7)));
+        OutputImage *waited = NULL;
+        std::thread requester([&] { waited = gatedFactoryAsync.requestImage(Z3i::Domain(Z3i::Point(0,0,0), Z3i::Point(7,7,7))); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        gatedFactory.openGate();
+        requester.join();
+        gatedFactoryAsync.wait();
+        nbok += (gatedFactory.getNbRequests() == 4 && (*waited)(Z3i::Point(1,2,3)) == image(Z3i::Point(1,2,3))) ? 1 : 0; nb++;
+        gatedFactoryAsync.detachImage(waited);
+        trace.info() << "(" << nbok << "/" << nb << ") waited image kept, requests: " << gatedFactory.getNbRequests() << endl;
+    }
+
+    // write-behind: the tiles are flushed in the background and read again after
+    const std::size_t tileBytes = 8*8*8*sizeof(int);
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryAsync> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryAsync> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryAsync, 3*tileBytes);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryAsync);
+
+    typedef TiledImage<VImage, MyImageFactoryAsync, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWB> MyTiledImage;
+    BOOST_CONCEPT_ASSERT(( concepts::CImage< MyTiledImage > ));
+    MyTiledImage tiledImage(imageFactoryAsync, imageCacheReadPolicyLRU, imageCacheWritePolicyWB, 4);
+    tiledImage.setPrefetch(2);
+
+    VImage reference(image.domain());
+    for (VImage::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it)
+      reference.setValue(*it, -image(*it));
+    std::vector<Z3i::Point> points;
+    for (int k = 0; k < 1000; k++)
+      points.push_back(Z3i::Point(rand() % 32, rand() % 32, rand() % 32));
+
+    for (MyTiledImage::OutputIterator it = tiledImage.begin(), itend = tiledImage.end(); it != itend; ++it)
+      *it = -(*it);
+    for (unsigned int k = 0; k < points.size(); k++)
+      {
+        tiledImage.setValue(points[k], tiledImage(points[k]) - 1);
+        reference.setValue(points[k], reference(points[k]) - 1);
+      }
+
+    bool ok = true;
+    for (VImage::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it)
+      ok = ok && (tiledImage(*it) == reference(*it));
+    nbok += ok ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") write-behind, prefetch hits: " << imageFactoryAsync.getNbPrefetchHits() << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -338,7 +560,8 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple() && test3d() && testIterators() && test_range_constRange(); // && ... other tests
+    bool res = testSimple() && test3d() && testIterators() && test_range_constRange()
+      && testLRUPrefetchAndConcurrentRead() && testAsyncFactory(); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
@@ -0,0 +1,193 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class MappedFileReader and ImageContainerByMappedFile.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include "DGtalCatch.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
+#include "DGtal/io/readers/MappedFileReader.h"
+#include "DGtal/io/readers/GenericReader.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/RawWriter.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MappedFileReader.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing MappedFileReader on vol files" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> MappedImage;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< MappedImage > ));
+
+  const Image image = VolReader<Image>::importVol( testPath + "samples/cat10.vol" );
+  REQUIRE( VolWriter<Image>::exportVol( "testMappedFileReader.vol", image, false ) );
+
+  SECTION( "Mapping an uncompressed vol file" )
+    {
+      const MappedImage mapped = GenericReader<MappedImage>::import( "testMappedFileReader.vol" );
+      trace.info() << mapped << endl;
+      REQUIRE( mapped.isValid() );
+      REQUIRE( ! mapped.isWritable() );
+      REQUIRE( mapped.domain().lowerBound() == image.domain().lowerBound() );
+      REQUIRE( mapped.domain().upperBound() == image.domain().upperBound() );
+      unsigned int nbok = 0;
+      for ( auto const& p : image.domain() )
+        nbok += ( mapped( p ) == image( p ) ) ? 1 : 0;
+      REQUIRE( nbok == image.domain().size() );
+      REQUIRE( std::equal( mapped.constRange().begin(), mapped.constRange().end(),
+                           image.constRange().begin() ) );
+      const Z3i::Point p( 3, -2, 5 );
+      REQUIRE( *( mapped.constRange().begin( p ) ) == image( p ) );
+      REQUIRE( mapped.data()[ mapped.linearized( p ) ] == image( p ) );
+    }
+
+  SECTION( "Compressed vol files cannot be mapped" )
+    {
+      REQUIRE_THROWS_AS( MappedFileReader<MappedImage>::importVol( testPath + "samples/cat10.vol" ),
+                         IOException );
+      VolWriter<Image>::exportChunkedVol( "testMappedFileReader4.vol", image, 1000 );
+      REQUIRE_THROWS_AS( MappedFileReader<MappedImage>::importVol( "testMappedFileReader4.vol" ),
+                         IOException );
+    }
+}
+
+TEST_CASE( "Testing MappedFileReader on raw files" )
+{
+  SECTION( "Mapping a 32 bits raw file" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> Image;
+      typedef ImageContainerByMappedFile<Z3i::Domain, DGtal::uint32_t> MappedImage;
+      const std::string filename = testPath + "samples/raw32bits5x5x5.raw";
+      const Image image = RawReader<Image>::importRaw32( filename, Z3i::Vector( 5, 5, 5 ) );
+      const MappedImage mapped = GenericReader<MappedImage>::import( filename, 5, 5, 5 );
+      REQUIRE( mapped.domain().size() == 125 );
+      REQUIRE( std::equal( mapped.constRange().begin(), mapped.constRange().end(),
+                           image.constRange().begin() ) );
+    }
+
+  SECTION( "Writing through a read-write mapping" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint16_t> Image;
+      typedef ImageContainerByMappedFile<Z3i::Domain, DGtal::uint16_t> MappedImage;
+      const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 9, 6, 4 ) );
+      Image image( domain );
+      for ( auto const& p : domain )
+        image.setValue( p, DGtal::uint16_t( 1000 * p[ 0 ] + 10 * p[ 1 ] + p[ 2 ] ) );
+      REQUIRE( RawWriter<Image>::exportRaw16( "testMappedFileReader.raw", image ) );
+
+      const Z3i::Point p( 4, 5, 2 );
+      {
+        MappedImage mapped = MappedFileReader<MappedImage>::importRaw( "testMappedFileReader.raw",
+                                                                       domain.upperBound() + Z3i::Vector::diagonal( 1 ),
+                                                                       true );
+        REQUIRE( mapped.isWritable() );
+        const MappedImage copy = mapped;
+        mapped.setValue( p, 12345 );
+        REQUIRE( copy( p ) == 12345 );
+        std::fill( mapped.range().begin(), mapped.range().begin() + 10, 7 );
+        mapped.flush();
+      }
+      const Image reread = RawReader<Image>::importRaw16( "testMappedFileReader.raw",
+                                                          domain.upperBound() + Z3i::Vector::diagonal( 1 ) );
+      REQUIRE( reread( p ) == 12345 );
+      REQUIRE( reread( Z3i::Point( 9, 0, 0 ) ) == 7 );
+      REQUIRE( reread( Z3i::Point( 0, 1, 0 ) ) == image( Z3i::Point( 0, 1, 0 ) ) );
+    }
+
+  SECTION( "Files too short cannot be mapped" )
+    {
+      typedef ImageContainerByMappedFile<Z3i::Domain, DGtal::uint32_t> MappedImage;
+      REQUIRE_THROWS_AS( MappedFileReader<MappedImage>::importRaw( testPath + "samples/raw32bits5x5x5.raw",
+                                                                   Z3i::Vector( 5, 5, 6 ) ),
+                         IOException );
+    }
+}
+
+TEST_CASE( "Testing MappedFileReader on longvol files" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> Image;
+  typedef ImageContainerByMappedFile<Z3i::Domain, DGtal::uint64_t> MappedImage;
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 9, 9, 9 ) );
+  Image image( domain );
+  for ( auto const& p : domain )
+    image.setValue( p, ( DGtal::uint64_t( p[ 0 ] + 1 ) << 40 ) + DGtal::uint64_t( 100 * p[ 1 ] + p[ 2 ] ) );
+  REQUIRE( LongvolWriter<Image>::exportLongvol( "testMappedFileReader.longvol", image, false ) );
+
+  SECTION( "Mapping an uncompressed longvol file, whose payload is not aligned" )
+    {
+      const MappedImage mapped = MappedFileReader<MappedImage>::importLongvol( "testMappedFileReader.longvol" );
+      REQUIRE( mapped.isValid() );
+      REQUIRE( mapped.domain().size() == 1000 );
+      unsigned int nbok = 0;
+      for ( auto const& p : domain )
+        nbok += ( mapped( p ) == image( p ) ) ? 1 : 0;
+      REQUIRE( nbok == 1000 );
+      REQUIRE( std::equal( mapped.constRange().begin(), mapped.constRange().end(),
+                           image.constRange().begin() ) );
+      const Z3i::Point p( 7, 2, 8 );
+      REQUIRE( *( mapped.constRange().begin( p ) ) == image( p ) );
+    }
+
+  SECTION( "Writing through a read-write mapping of a longvol file" )
+    {
+      const Z3i::Point p( 1, 8, 3 );
+      {
+        MappedImage mapped = GenericReader<MappedImage>::import( "testMappedFileReader.longvol" );
+        REQUIRE( mapped( p ) == image( p ) );
+        MappedImage writable = MappedFileReader<MappedImage>::importLongvol( "testMappedFileReader.longvol", true );
+        writable.setValue( p, 0x0123456789abcdefULL );
+        std::fill( writable.range().begin(), writable.range().begin() + 3, DGtal::uint64_t( 42 ) );
+        *( writable.range().begin() + 5 ) = *( writable.range().begin() + 6 );
+        writable.flush();
+      }
+      const Image reread = LongvolReader<Image>::importLongvol( "testMappedFileReader.longvol" );
+      REQUIRE( reread( p ) == 0x0123456789abcdefULL );
+      REQUIRE( reread( Z3i::Point( 2, 0, 0 ) ) == 42 );
+      REQUIRE( reread( Z3i::Point( 5, 0, 0 ) ) == image( Z3i::Point( 6, 0, 0 ) ) );
+      REQUIRE( reread( Z3i::Point( 0, 1, 0 ) ) == image( Z3i::Point( 0, 1, 0 ) ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
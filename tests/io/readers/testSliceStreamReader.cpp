@@ -0,0 +1,196 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing classes SliceStreamReader and SliceStreamWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtalCatch.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/SliceStreamReader.h"
+#include "DGtal/io/writers/SliceStreamWriter.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes SliceStreamReader and SliceStreamWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Reads a file slab by slab, checks the slabs against a reference
+ * image and writes them (if a writer is given).
+ * @return the number of values different from the reference.
+ */
+template <typename Image, typename Reference, typename Writer>
+unsigned int streamSlabs( SliceStreamReader<Image> & reader, const Reference & reference,
+                          unsigned int k, Writer * writer )
+{
+  unsigned int nbfail = 0;
+  while ( reader.hasNextSlab() )
+    {
+      const typename SliceStreamReader<Image>::Integer z = reader.nextSlice();
+      const Image slab = reader.readSlab( k );
+      nbfail += ( slab.domain().lowerBound()[ 2 ] == z ) ? 0 : 1;
+      for ( auto const& p : slab.domain() )
+        nbfail += ( slab( p ) == reference( p ) ) ? 0 : 1;
+      if ( writer != NULL )
+        writer->writeSlab( slab );
+    }
+  return nbfail;
+}
+
+TEST_CASE( "Testing SliceStreamReader and SliceStreamWriter on vol files" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  const std::string filename = testPath + "samples/cat10.vol";
+  const Image image = VolReader<Image>::importVol( filename );
+
+  SECTION( "Streaming a compressed vol file" )
+    {
+      SliceStreamReader<Image> reader( filename );
+      trace.info() << reader << endl;
+      REQUIRE( reader.format() == SliceStreamReader<Image>::VOL );
+      REQUIRE( reader.domain().lowerBound() == image.domain().lowerBound() );
+      REQUIRE( reader.domain().upperBound() == image.domain().upperBound() );
+      SliceStreamWriter<Image> writer( "testSliceStreamReader.vol", reader.domain(), true );
+      REQUIRE( streamSlabs( reader, image, 7, &writer ) == 0 );
+      writer.close();
+
+      const Image written = VolReader<Image>::importVol( "testSliceStreamReader.vol" );
+      REQUIRE( written.domain().lowerBound() == image.domain().lowerBound() );
+      REQUIRE( std::equal( written.constRange().begin(), written.constRange().end(),
+                           image.constRange().begin() ) );
+    }
+
+  SECTION( "Streaming an uncompressed longvol file" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> LongImage;
+      {
+        SliceStreamReader<LongImage> reader( filename );
+        SliceStreamWriter<LongImage> writer( "testSliceStreamReader.longvol", reader.domain() );
+        REQUIRE( streamSlabs( reader, image, 1, &writer ) == 0 );
+        writer.close();
+      }
+      const LongImage written = LongvolReader<LongImage>::importLongvol( "testSliceStreamReader.longvol" );
+      REQUIRE( std::equal( written.constRange().begin(), written.constRange().end(),
+                           image.constRange().begin() ) );
+      SliceStreamReader<LongImage> reader( "testSliceStreamReader.longvol" );
+      REQUIRE( streamSlabs( reader, image, 16, (SliceStreamWriter<LongImage>*) NULL ) == 0 );
+    }
+
+  SECTION( "Streaming vol and longvol files compressed in chunks" )
+    {
+      VolWriter<Image>::exportChunkedVol( "testSliceStreamReader4.vol", image, 1000 );
+      SliceStreamReader<Image> reader( "testSliceStreamReader4.vol" );
+      REQUIRE( reader.domain().lowerBound() == image.domain().lowerBound() );
+      REQUIRE( streamSlabs( reader, image, 3, (SliceStreamWriter<Image>*) NULL ) == 0 );
+
+      typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> LongImage;
+      LongImage longimage( image.domain() );
+      std::copy( image.constRange().begin(), image.constRange().end(), longimage.range().begin() );
+      LongvolWriter<LongImage>::exportChunkedLongvol( "testSliceStreamReader4.longvol", longimage, 8 * 1001 );
+      SliceStreamReader<LongImage> longreader( "testSliceStreamReader4.longvol" );
+      REQUIRE( streamSlabs( longreader, image, 16, (SliceStreamWriter<LongImage>*) NULL ) == 0 );
+    }
+
+  SECTION( "Slabs must be written in order" )
+    {
+      SliceStreamWriter<Image> writer( "testSliceStreamReader2.vol", image.domain() );
+      Z3i::Point upper = image.domain().upperBound();
+      upper[ 2 ] = image.domain().lowerBound()[ 2 ] + 1;
+      Image slab( Z3i::Domain( image.domain().lowerBound(), upper ) );
+      writer.writeSlab( slab );
+      REQUIRE( writer.nextSlice() == upper[ 2 ] + 1 );
+      REQUIRE_THROWS_AS( writer.writeSlab( slab ), IOException );
+      REQUIRE_THROWS_AS( writer.close(), IOException );
+    }
+}
+
+TEST_CASE( "Testing SliceStreamReader and SliceStreamWriter on raw and pgm files" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned int> Image;
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 12, 6, 9 ) );
+  Image image( domain );
+  for ( auto const& p : domain )
+    image.setValue( p, ( 97 * p[ 0 ] + 31 * p[ 1 ] + 7 * p[ 2 ] ) % 256 );
+
+  SECTION( "Raw files of 16 bits values" )
+    {
+      {
+        SliceStreamWriter<Image> writer( "testSliceStreamReader.raw", domain, false, 2 );
+        Z3i::Point upper = domain.upperBound();
+        for ( Z3i::Integer z = 0; z <= domain.upperBound()[ 2 ]; z += 3 )
+          {
+            upper[ 2 ] = std::min( z + 2, domain.upperBound()[ 2 ] );
+            Image slab( Z3i::Domain( Z3i::Point( 0, 0, z ), upper ) );
+            for ( auto const& p : slab.domain() )
+              slab.setValue( p, image( p ) + 1000 );
+            writer.writeSlab( slab );
+          }
+        writer.close();
+      }
+      const Image written = RawReader<Image>::importRaw16( "testSliceStreamReader.raw",
+                                                           Z3i::Vector( 13, 7, 10 ) );
+      unsigned int nbok = 0;
+      for ( auto const& p : domain )
+        nbok += ( written( p ) == image( p ) + 1000 ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+      SliceStreamReader<Image> reader( "testSliceStreamReader.raw", Z3i::Vector( 13, 7, 10 ), 2 );
+      REQUIRE( streamSlabs( reader, written, 4, (SliceStreamWriter<Image>*) NULL ) == 0 );
+    }
+
+  SECTION( "PGM3D files" )
+    {
+      {
+        SliceStreamReader<Image> reader( testPath + "samples/raw32bits5x5x5.raw", Z3i::Vector( 5, 5, 5 ), 4 );
+        SliceStreamWriter<Image> writer( "testSliceStreamReader.pgm3d", reader.domain() );
+        const Image ref = RawReader<Image>::importRaw32( testPath + "samples/raw32bits5x5x5.raw",
+                                                         Z3i::Vector( 5, 5, 5 ) );
+        REQUIRE( streamSlabs( reader, ref, 2, &writer ) == 0 );
+        writer.close();
+      }
+      const Image written = PGMReader<Image>::importPGM3D( "testSliceStreamReader.pgm3d" );
+      REQUIRE( written.domain().size() == 125 );
+      SliceStreamReader<Image> reader( "testSliceStreamReader.pgm3d" );
+      REQUIRE( reader.format() == SliceStreamReader<Image>::PGM3D );
+      REQUIRE( streamSlabs( reader, written, 2, (SliceStreamWriter<Image>*) NULL ) == 0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
+#include <string>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -111,4 +113,51 @@ TEST_CASE( "Testing CompressedLongvol" )
     }
 }
 
+TEST_CASE( "Testing chunked vol and longvol" )
+{
+  Domain domain(Point(-3,0,2), Point(40,30,20));
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<Domain, DGtal::uint64_t> LongImage;
+  Image image(domain);
+  LongImage longimage(domain);
+  for(auto p: domain)
+  {
+    image.setValue(p, (unsigned char)( (p[0]*p[1] + p[2]) % 7 ));
+    longimage.setValue(p, DGtal::uint64_t(p[0]+3) << (p[1] + p[2]));
+  }
+  
+  SECTION("Testing write/read of chunked vol (many chunks)")
+  {
+    VolWriter<Image>::exportChunkedVol("testchunks.vol", image, 1000);
+    Image read = VolReader<Image>::importVol("testchunks.vol");
+    REQUIRE( read.domain().lowerBound() == domain.lowerBound() );
+    REQUIRE( (checkImage(image,read) == true)) ;
+  }
+  
+  SECTION("Testing write/read of chunked longvol (one chunk)")
+  {
+    LongvolWriter<LongImage>::exportChunkedLongvol("testchunks.lvol", longimage);
+    LongImage read = LongvolReader<LongImage>::importLongvol("testchunks.lvol");
+    REQUIRE( (checkImage(longimage,read) == true)) ;
+    LongvolWriter<LongImage>::exportChunkedLongvol("testchunks2.lvol", longimage, 8*1001);
+    LongImage read2 = LongvolReader<LongImage>::importLongvol("testchunks2.lvol");
+    REQUIRE( (checkImage(longimage,read2) == true)) ;
+  }
+  
+  SECTION("Testing read of chunked vol with a corrupted index")
+  {
+    VolWriter<Image>::exportChunkedVol("testchunks3.vol", image, 1000);
+    std::fstream file("testchunks3.vol", std::ios::in | std::ios::out | std::ios::binary);
+    std::string line;
+    while ( std::getline(file, line) && line != "." ) {}
+    const std::streampos index = file.tellg();
+    // length of the first chunk much larger than the file
+    file.seekp(index);
+    const char huge[8] = { 0, 0, 0, 0, 0, 0, 0, 0x10 };
+    file.write(huge, 8);
+    file.close();
+    REQUIRE_THROWS_AS( VolReader<Image>::importVol("testchunks3.vol"), DGtal::IOException );
+  }
+}
+
 /** @ingroup Tests **/
@@ -0,0 +1,196 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class DigitalSetByRunLength.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <cstdlib>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByRunLength.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByRunLength.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetByRunLength<Z3i::Domain> RLSet;
+typedef Z3i::Point Point;
+
+/// @return 'true' iff the sets have the same points.
+template <typename Set>
+bool sameSet( const RLSet & set, const Set & ref )
+{
+  if ( set.size() != ref.size() ) return false;
+  for ( auto const& p : ref )
+    if ( ! set( p ) ) return false;
+  for ( auto const& p : set )
+    if ( ref.count( p ) == 0 ) return false;
+  return set.isValid();
+}
+
+TEST_CASE( "Testing DigitalSetByRunLength" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< RLSet > ));
+  REQUIRE(( std::is_same< DigitalSetSelector< Z3i::Domain, BIG_DS + HIGH_RUN_DS >::Type,
+            RLSet >::value ));
+
+  srand( 0 );
+  Z3i::Domain domain( Point( -5, -4, 2 ), Point( 6, 3, 7 ) );
+  RLSet set( domain );
+  std::set<Point> ref;
+  for ( unsigned int i = 0; i < 600; ++i )
+    {
+      Point p( rand() % 12 - 5, rand() % 8 - 4, rand() % 6 + 2 );
+      if ( i % 3 == 2 ) { set.erase( p ); ref.erase( p ); }
+      else { set.insert( p ); ref.insert( p ); }
+    }
+
+  SECTION( "Insertion, removal and iteration" )
+    {
+      REQUIRE( sameSet( set, ref ) );
+      // Points are visited in the order of the domain.
+      std::vector<Point> points( set.begin(), set.end() );
+      std::vector<Point> ordered;
+      for ( auto const& p : domain )
+        if ( ref.count( p ) ) ordered.push_back( p );
+      REQUIRE( points == ordered );
+      Point p = *( ++set.begin() );
+      REQUIRE( *set.find( p ) == p );
+      REQUIRE( set.find( Point( 100, 0, 0 ) ) == set.end() );
+      set.erase( set.find( p ) );
+      ref.erase( p );
+      REQUIRE( sameSet( set, ref ) );
+      const std::vector<Point> erased( set.begin(), set.find( points[ 10 ] ) );
+      set.erase( set.begin(), set.find( points[ 10 ] ) );
+      for ( auto const& q : erased ) ref.erase( q );
+      REQUIRE( erased.size() == 9 );
+      REQUIRE( sameSet( set, ref ) );
+      REQUIRE( set.nbRuns() < set.size() );
+      set.clear();
+      REQUIRE( set.empty() );
+      REQUIRE( set.begin() == set.end() );
+    }
+
+  SECTION( "Set operations on runs" )
+    {
+      RLSet other( domain );
+      std::set<Point> refOther;
+      for ( unsigned int i = 0; i < 400; ++i )
+        {
+          Point p( rand() % 12 - 5, rand() % 8 - 4, rand() % 6 + 2 );
+          other.insert( p ); refOther.insert( p );
+        }
+      std::set<Point> refUnion( ref ), refInter, refDiff;
+      refUnion.insert( refOther.begin(), refOther.end() );
+      for ( auto const& p : ref )
+        if ( refOther.count( p ) ) refInter.insert( p );
+        else refDiff.insert( p );
+      RLSet u( set ), n( set ), d( set );
+      u += other;
+      n &= other;
+      d -= other;
+      REQUIRE( sameSet( u, refUnion ) );
+      REQUIRE( sameSet( n, refInter ) );
+      REQUIRE( sameSet( d, refDiff ) );
+
+      RLSet c( domain );
+      c.assignFromComplement( set );
+      std::vector<Point> complement;
+      std::back_insert_iterator< std::vector<Point> > out = std::back_inserter( complement );
+      set.computeComplement( out );
+      REQUIRE( c.size() == domain.size() - set.size() );
+      REQUIRE( complement == std::vector<Point>( c.begin(), c.end() ) );
+      c += set;
+      REQUIRE( c.size() == domain.size() );
+      REQUIRE( c.nbRuns() == c.nbRows() );
+
+      Point lower, upper, refLower, refUpper;
+      set.computeBoundingBox( lower, upper );
+      refLower = refUpper = *ref.begin();
+      for ( auto const& p : ref )
+        { refLower = refLower.inf( p ); refUpper = refUpper.sup( p ); }
+      REQUIRE( lower == refLower );
+      REQUIRE( upper == refUpper );
+    }
+
+  SECTION( "6/18/26 neighborhoods on runs" )
+    {
+      MetricAdjacency<Z3i::Space, 1> adj6;
+      MetricAdjacency<Z3i::Space, 2> adj18;
+      MetricAdjacency<Z3i::Space, 3> adj26;
+      unsigned int nbok = 0, nb = 0;
+      for ( auto const& p : domain )
+        {
+          std::vector<Point> N6, N18, N26;
+          std::back_insert_iterator< std::vector<Point> > o6 = std::back_inserter( N6 );
+          std::back_insert_iterator< std::vector<Point> > o18 = std::back_inserter( N18 );
+          std::back_insert_iterator< std::vector<Point> > o26 = std::back_inserter( N26 );
+          set.writeNeighbors( o6, p, 1 );
+          set.writeNeighbors( o18, p, 2 );
+          set.writeNeighbors( o26, p, 3 );
+          std::set<Point> R6, R18, R26;
+          for ( auto const& q : ref )
+            {
+              if ( adj6.isProperlyAdjacentTo( p, q ) ) R6.insert( q );
+              if ( adj18.isProperlyAdjacentTo( p, q ) ) R18.insert( q );
+              if ( adj26.isProperlyAdjacentTo( p, q ) ) R26.insert( q );
+            }
+          nbok += ( std::set<Point>( N6.begin(), N6.end() ) == R6 && N6.size() == R6.size() ) ? 1 : 0;
+          nbok += ( std::set<Point>( N18.begin(), N18.end() ) == R18 && N18.size() == R18.size() ) ? 1 : 0;
+          nbok += ( std::set<Point>( N26.begin(), N26.end() ) == R26 && N26.size() == R26.size() ) ? 1 : 0;
+          nbok += ( set.countNeighbors( p, 3 ) == R26.size() ) ? 1 : 0;
+          nb += 4;
+        }
+      REQUIRE( nbok == nb );
+    }
+}
+
+TEST_CASE( "Testing DigitalSetByRunLength memory on a ball" )
+{
+  Z3i::Domain domain( Point::diagonal( -128 ), Point::diagonal( 127 ) );
+  RLSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Point::zero, 100 );
+  REQUIRE( set.isValid() );
+  REQUIRE( set.nbRuns() < 40000 );
+  // Less than one bit per point of the domain.
+  REQUIRE( 8 * set.memoryUsage() < domain.size() );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
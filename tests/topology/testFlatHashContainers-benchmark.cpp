@@ -0,0 +1,177 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFlatHashContainers-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Benchmarks the containers of cells given by StdCellContainers,
+ * std::unordered_set, FlatHashCellContainers and PackedCellContainers
+ * when tracking a digital surface and when closing a cubical complex.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <unordered_set>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskyCellContainers.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/CubicalComplex.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking containers of cells.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Implicit digital ellipsoid, as in testLightImplicitDigitalSurface-benchmark.
+struct ImplicitDigitalEllipse3 {
+  typedef Z3i::Point Point;
+  ImplicitDigitalEllipse3( double a, double b, double c )
+    : myA( a ), myB( b ), myC( c ) {}
+  bool operator()( const Point & p ) const
+  {
+    double x = ( (double) p[ 0 ] / myA );
+    double y = ( (double) p[ 1 ] / myB );
+    double z = ( (double) p[ 2 ] / myC );
+    return ( x*x + y*y + z*z ) <= 1.0;
+  }
+  double myA, myB, myC;
+};
+
+/// Estimated memory of node based containers (payload and three
+/// pointers and a color for trees, payload, next pointer, hash and
+/// bucket pointer for unordered containers).
+template <typename Value>
+std::size_t treeMemory( std::size_t n )
+{ return n * ( sizeof( Value ) + 4 * sizeof( void* ) ); }
+template <typename Value>
+std::size_t hashMemory( std::size_t n )
+{ return n * ( sizeof( Value ) + 3 * sizeof( void* ) ); }
+
+/**
+ * Tracks the boundary of the ellipsoid with a set of type SCellSet.
+ * @return the number of surfels.
+ */
+template <typename SCellSet>
+std::size_t trackEllipse( const Z3i::KSpace & K, const ImplicitDigitalEllipse3 & shape,
+                          const Z3i::SCell & bel, const std::string & name,
+                          SCellSet & surface )
+{
+  trace.beginBlock( "Tracking the boundary with " + name );
+  Surfaces<Z3i::KSpace>::trackClosedBoundary( surface, K, SurfelAdjacency<3>( true ),
+                                              shape, bel );
+  std::size_t nb = 0;
+  for ( auto const& s : surface )
+    nb += K.sIsInside( s ) ? 1 : 0;
+  trace.info() << surface.size() << " surfels (" << nb << " visited)." << std::endl;
+  trace.endBlock();
+  return surface.size();
+}
+
+/**
+ * Closes the complex made of the voxels of the ellipsoid.
+ * @return the number of cells.
+ */
+template <typename CC>
+std::size_t closeEllipse( const Z3i::KSpace & K, const ImplicitDigitalEllipse3 & shape,
+                          const Z3i::Domain & domain, const std::string & name,
+                          CC & complex )
+{
+  trace.beginBlock( "Closing a cubical complex with " + name );
+  for ( auto const& p : domain )
+    if ( shape( p ) ) complex.insertCell( K.uSpel( p ) );
+  complex.close();
+  std::size_t nb = 0;
+  for ( Dimension d = 0; d <= 3; ++d ) nb += complex.nbCells( d );
+  trace.info() << nb << " cells." << std::endl;
+  trace.endBlock();
+  return nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int, char** )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef KSpace::SCell SCell;
+  typedef FlatHashCellContainers<KSpace> Flat;
+  typedef StdCellContainers<KSpace> Std;
+
+  Z3i::Point p1( -200, -200, -200 ), p2( 200, 200, 200 );
+  KSpace K;
+  K.init( p1, p2, true );
+  ImplicitDigitalEllipse3 ellipse( 180.0, 135.0, 102.0 );
+  SCell bel = Surfaces<KSpace>::findABel( K, ellipse, 10000 );
+  bool res = true;
+
+  trace.beginBlock( "Benchmarking sets of surfels" );
+  std::size_t nbStd, nbUnordered, nbFlat, nbPacked;
+  {
+    Std::SCellSet surface;
+    nbStd = trackEllipse( K, ellipse, bel, "std::set", surface );
+    trace.info() << "memory ~ " << treeMemory<SCell>( nbStd ) << "B" << std::endl;
+  }
+  {
+    std::unordered_set<SCell> surface;
+    nbUnordered = trackEllipse( K, ellipse, bel, "std::unordered_set", surface );
+    trace.info() << "memory ~ " << hashMemory<SCell>( nbUnordered ) << "B" << std::endl;
+  }
+  {
+    Flat::SCellSet surface;
+    nbFlat = trackEllipse( K, ellipse, bel, "FlatHashSet", surface );
+    trace.info() << "memory = " << surface.memoryUsage() << "B " << surface << std::endl;
+  }
+  {
+    PackedCellContainers<KSpace>::SCellSet surface;
+    nbPacked = trackEllipse( K, ellipse, bel, "PackedCellSet", surface );
+    trace.info() << "memory = " << surface.memoryUsage() << "B" << std::endl;
+  }
+  res = res && nbStd == nbUnordered && nbStd == nbFlat && nbStd == nbPacked;
+  trace.endBlock();
+
+  trace.beginBlock( "Benchmarking maps of cells" );
+  Z3i::Domain domain( Z3i::Point( -100, -100, -100 ), Z3i::Point( 100, 100, 100 ) );
+  ImplicitDigitalEllipse3 small( 90.0, 67.0, 51.0 );
+  {
+    CubicalComplex< KSpace > complex( K );
+    nbStd = closeEllipse( K, small, domain, "std::map", complex );
+    typedef std::pair<const KSpace::Cell, CubicalCellData> Value;
+    trace.info() << "memory ~ " << treeMemory<Value>( nbStd ) << "B" << std::endl;
+  }
+  {
+    CubicalComplex< KSpace, Flat::CellMap<CubicalCellData>::Type > complex( K );
+    nbFlat = closeEllipse( K, small, domain, "FlatHashMap", complex );
+    std::size_t memory = 0;
+    for ( Dimension d = 0; d <= 3; ++d ) memory += complex.getCells( d ).memoryUsage();
+    trace.info() << "memory = " << memory << "B" << std::endl;
+  }
+  res = res && nbStd == nbFlat;
+  trace.endBlock();
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
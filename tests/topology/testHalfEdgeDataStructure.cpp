@@ -30,6 +30,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <algorithm>
+#include <map>
+#include <set>
+#include <string>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -639,3 +642,221 @@ SCENARIO( "HalfEdgeDataStructure merges", "[halfedge][merges]" ){
 }
 
 /** @ingroup Tests **/
+
+/// @return 'true' iff both data structures have the same half-edges
+/// and the same half-edges associated to vertices, faces and edges.
+bool sameHalfEdgeLayout( const HalfEdgeDataStructure& m1, const HalfEdgeDataStructure& m2 )
+{
+  if ( m1.nbHalfEdges() != m2.nbHalfEdges() || m1.nbVertices() != m2.nbVertices()
+       || m1.nbFaces() != m2.nbFaces() || m1.nbEdges() != m2.nbEdges() ) return false;
+  for ( Size i = 0; i < m1.nbHalfEdges(); ++i )
+    {
+      const auto& he1 = m1.halfEdge( i );
+      const auto& he2 = m2.halfEdge( i );
+      if ( he1.toVertex != he2.toVertex || he1.face != he2.face || he1.edge != he2.edge
+           || he1.opposite != he2.opposite || he1.next != he2.next ) return false;
+    }
+  for ( Size v = 0; v < m1.nbVertices(); ++v )
+    if ( m1.halfEdgeIndexFromVertexIndex( v ) != m2.halfEdgeIndexFromVertexIndex( v ) ) return false;
+  for ( Size f = 0; f < m1.nbFaces(); ++f )
+    if ( m1.halfEdgeIndexFromFaceIndex( f ) != m2.halfEdgeIndexFromFaceIndex( f ) ) return false;
+  for ( Size e = 0; e < m1.nbEdges(); ++e )
+    if ( m1.halfEdgeIndexFromEdgeIndex( e ) != m2.halfEdgeIndexFromEdgeIndex( e ) ) return false;
+  return true;
+}
+
+/// Half-edges of a mesh as computed by the former map-based build.
+struct ReferenceHalfEdges
+{
+  std::vector< HalfEdgeDataStructure::HalfEdge > halfEdges;
+  std::vector< HalfEdgeDataStructure::Index >    vertexHalfEdges;
+  std::vector< HalfEdgeDataStructure::Index >    faceHalfEdges;
+  std::vector< HalfEdgeDataStructure::Index >    edgeHalfEdges;
+};
+
+/// Builds the half-edges of a valid mesh with std::map and std::set, as
+/// HalfEdgeDataStructure::build did before its sort-based version.
+/// @return the edges (lexicographically sorted) and the half-edges.
+std::pair< std::vector< Edge >, ReferenceHalfEdges >
+referenceBuild( const std::vector< PolygonalFace >& faces )
+{
+  typedef HalfEdgeDataStructure::Index Index;
+  const Index invalid = HALF_EDGE_INVALID_INDEX;
+  std::set< Edge > edgeSet;
+  std::set< Index > vertexSet;
+  std::map< ArcT, Index > arc2face;
+  for ( Index f = 0; f < faces.size(); ++f )
+    for ( Size i = 0; i < faces[ f ].size(); ++i )
+      {
+        const Index v0 = faces[ f ][ i ];
+        const Index v1 = faces[ f ][ ( i + 1 ) % faces[ f ].size() ];
+        edgeSet.insert( Edge( v0, v1 ) );
+        vertexSet.insert( v0 );
+        arc2face[ ArcT( v0, v1 ) ] = f;
+      }
+  const std::vector< Edge > edges( edgeSet.begin(), edgeSet.end() );
+  ReferenceHalfEdges ref;
+  ref.vertexHalfEdges.assign( vertexSet.size(), invalid );
+  ref.faceHalfEdges.assign( faces.size(), invalid );
+  ref.edgeHalfEdges.assign( edges.size(), invalid );
+  std::map< ArcT, Index > arc2index;
+  auto faceOf = [&] ( Index i, Index j )
+    { auto it = arc2face.find( ArcT( i, j ) ); return it == arc2face.end() ? invalid : it->second; };
+  for ( Index ei = 0; ei < edges.size(); ++ei )
+    {
+      HalfEdgeDataStructure::HalfEdge he0, he1;
+      const Index h0 = ref.halfEdges.size(), h1 = h0 + 1;
+      he0.face = faceOf( edges[ ei ].v[ 0 ], edges[ ei ].v[ 1 ] );
+      he1.face = faceOf( edges[ ei ].v[ 1 ], edges[ ei ].v[ 0 ] );
+      he0.toVertex = edges[ ei ].v[ 1 ];
+      he1.toVertex = edges[ ei ].v[ 0 ];
+      he0.edge = he1.edge = ei;
+      he0.opposite = h1;
+      he1.opposite = h0;
+      arc2index[ ArcT( edges[ ei ].v[ 0 ], edges[ ei ].v[ 1 ] ) ] = h0;
+      arc2index[ ArcT( edges[ ei ].v[ 1 ], edges[ ei ].v[ 0 ] ) ] = h1;
+      if ( ref.vertexHalfEdges[ he0.toVertex ] == invalid || he1.face == invalid )
+        ref.vertexHalfEdges[ he0.toVertex ] = h1;
+      if ( ref.vertexHalfEdges[ he1.toVertex ] == invalid || he0.face == invalid )
+        ref.vertexHalfEdges[ he1.toVertex ] = h0;
+      if ( he0.face != invalid && ref.faceHalfEdges[ he0.face ] == invalid )
+        ref.faceHalfEdges[ he0.face ] = h0;
+      if ( he1.face != invalid && ref.faceHalfEdges[ he1.face ] == invalid )
+        ref.faceHalfEdges[ he1.face ] = h1;
+      ref.edgeHalfEdges[ ei ] = h0;
+      ref.halfEdges.push_back( he0 );
+      ref.halfEdges.push_back( he1 );
+    }
+  std::map< Index, std::set< Index > > outgoingBoundary;
+  for ( Index h = 0; h < ref.halfEdges.size(); ++h )
+    {
+      auto& he = ref.halfEdges[ h ];
+      if ( he.face == invalid )
+        outgoingBoundary[ ref.halfEdges[ he.opposite ].toVertex ].insert( h );
+      else
+        {
+          const PolygonalFace& P = faces[ he.face ];
+          const auto it = std::find( P.begin(), P.end(), he.toVertex );
+          const Index j = ( it + 1 == P.end() ) ? P.front() : *( it + 1 );
+          he.next = arc2index[ ArcT( he.toVertex, j ) ];
+        }
+    }
+  for ( auto& he : ref.halfEdges )
+    if ( he.face == invalid )
+      {
+        auto& outgoing = outgoingBoundary[ he.toVertex ];
+        he.next = *outgoing.begin();
+        outgoing.erase( outgoing.begin() );
+      }
+  return std::make_pair( edges, ref );
+}
+
+/// @return 'true' iff the data structure has the half-edges of the
+/// map-based reference build.
+bool sameAsReference( const HalfEdgeDataStructure& mesh, const ReferenceHalfEdges& ref )
+{
+  if ( mesh.nbHalfEdges() != ref.halfEdges.size() || mesh.nbVertices() != ref.vertexHalfEdges.size()
+       || mesh.nbFaces() != ref.faceHalfEdges.size() || mesh.nbEdges() != ref.edgeHalfEdges.size() )
+    return false;
+  for ( Size i = 0; i < mesh.nbHalfEdges(); ++i )
+    {
+      const auto& he1 = mesh.halfEdge( i );
+      const auto& he2 = ref.halfEdges[ i ];
+      if ( he1.toVertex != he2.toVertex || he1.face != he2.face || he1.edge != he2.edge
+           || he1.opposite != he2.opposite || he1.next != he2.next ) return false;
+    }
+  for ( Size v = 0; v < mesh.nbVertices(); ++v )
+    if ( mesh.halfEdgeIndexFromVertexIndex( v ) != ref.vertexHalfEdges[ v ] ) return false;
+  for ( Size f = 0; f < mesh.nbFaces(); ++f )
+    if ( mesh.halfEdgeIndexFromFaceIndex( f ) != ref.faceHalfEdges[ f ] ) return false;
+  for ( Size e = 0; e < mesh.nbEdges(); ++e )
+    if ( mesh.halfEdgeIndexFromEdgeIndex( e ) != ref.edgeHalfEdges[ e ] ) return false;
+  return true;
+}
+
+SCENARIO( "HalfEdgeDataStructure build against the map-based build", "[halfedge][build]" ){
+  std::map< std::string, std::vector< PolygonalFace > > meshes;
+  meshes[ "pyramid" ]  = { { 0, 3, 2, 1 }, { 0, 1, 4 }, { 1, 2, 4 }, { 2, 3, 4 }, { 3, 0, 4 } };
+  meshes[ "box" ]      = { { 1, 0, 2, 3 }, { 0, 1, 5, 4 }, { 1, 3, 7, 5 }, { 3, 2, 6, 7 },
+                           { 2, 0, 4, 6 }, { 4, 5, 8, 9 } };
+  meshes[ "ribbon" ]   = { { 0, 1, 2 }, { 2, 1, 3 }, { 2, 3, 4 }, { 4, 3, 5 }, { 4, 5, 0 }, { 0, 5, 1 } };
+  // A shuffled 40x40 torus grid with a hole, quads and pairs of triangles.
+  const Size n = 40;
+  std::vector< PolygonalFace > grid;
+  for ( Size y = 0; y < n; ++y )
+    for ( Size x = 0; x < n; ++x )
+      {
+        if ( x >= 10 && x < 15 && y == 20 ) continue; // no isolated vertex
+        const Size a = y * n + x, b = y * n + ( x + 1 ) % n;
+        const Size d = ( ( y + 1 ) % n ) * n + x, c = ( ( y + 1 ) % n ) * n + ( x + 1 ) % n;
+        if ( ( x + 2 * y ) % 5 == 0 ) { grid.push_back( { a, b, c } ); grid.push_back( { a, c, d } ); }
+        else grid.push_back( { a, b, c, d } );
+      }
+  for ( Size i = grid.size() - 1; i > 0; --i )
+    std::swap( grid[ i ], grid[ ( i * 7919 + 13 ) % ( i + 1 ) ] );
+  meshes[ "grid" ] = grid;
+  for ( const auto& named : meshes )
+    {
+      GIVEN( "The " + named.first + " mesh" ) {
+        const auto reference = referenceBuild( named.second );
+        std::vector< Edge > edges;
+        const Size nbV
+          = HalfEdgeDataStructure::getUnorderedEdgesFromPolygonalFaces( named.second, edges );
+        HalfEdgeDataStructure mesh;
+        const bool ok = mesh.build( nbV, named.second, edges );
+        THEN( "It has the same edges and half-edges as the map-based build" ) {
+          REQUIRE( ok );
+          REQUIRE( nbV == reference.second.vertexHalfEdges.size() );
+          REQUIRE( edges.size() == reference.first.size() );
+          REQUIRE( std::equal( edges.begin(), edges.end(), reference.first.begin(),
+                               [] ( const Edge& e1, const Edge& e2 )
+                               { return e1.v[ 0 ] == e2.v[ 0 ] && e1.v[ 1 ] == e2.v[ 1 ]; } ) );
+          REQUIRE( sameAsReference( mesh, reference.second ) );
+        }
+      }
+    }
+}
+
+SCENARIO( "HalfEdgeDataStructure build from many faces", "[halfedge][build]" ){
+  GIVEN( "A 300x300 grid of vertices, with quads and pairs of triangles" ) {
+    const Size n = 300;
+    std::vector< PolygonalFace > faces;
+    for ( Size y = 0; y + 1 < n; ++y )
+      for ( Size x = 0; x + 1 < n; ++x )
+        {
+          const Size a = y * n + x, b = a + 1, c = a + n + 1, d = a + n;
+          if ( ( x + y ) % 3 == 0 ) { faces.push_back( { a, b, c } ); faces.push_back( { a, c, d } ); }
+          else faces.push_back( { a, b, c, d } );
+        }
+    std::reverse( faces.begin(), faces.end() );
+    std::vector< Edge > edges;
+    const Size nbV = HalfEdgeDataStructure::getUnorderedEdgesFromPolygonalFaces( faces, edges );
+    HalfEdgeDataStructure mesh, pmesh;
+    const bool ok  = mesh.build( nbV, faces, edges );
+    const bool pok = pmesh.build( faces, true );
+    THEN( "The mesh is valid, with unique and sorted edges" ) {
+      REQUIRE( ok );
+      REQUIRE( mesh.isValid() );
+      REQUIRE( nbV == n * n );
+      REQUIRE( std::adjacent_find( edges.begin(), edges.end(),
+                                   [] ( const Edge& e1, const Edge& e2 )
+                                   { return ! ( e1 < e2 ); } ) == edges.end() );
+      REQUIRE( mesh.nbFaces() == faces.size() );
+      // Euler characteristic of a disk.
+      REQUIRE( nbV + mesh.nbFaces() == mesh.nbEdges() + 1 );
+    }
+    THEN( "The serial and parallel builds give the same half-edges" ) {
+      REQUIRE( pok );
+      REQUIRE( sameHalfEdgeLayout( mesh, pmesh ) );
+    }
+    THEN( "Each half-edge is found from its arc" ) {
+      Size nb_ok = 0;
+      for ( Size i = 0; i < mesh.nbHalfEdges(); ++i )
+        {
+          const auto& he = mesh.halfEdge( i );
+          nb_ok += mesh.halfEdgeIndexFromArc( mesh.halfEdge( he.opposite ).toVertex, he.toVertex ) == i;
+        }
+      REQUIRE( nb_ok == mesh.nbHalfEdges() );
+    }
+  }
+}
@@ -110,6 +110,68 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
   }
 }
 
+SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > parallel build tests", "[idxdsurf][build]" )
+{
+  typedef DigitalSetBoundary< KSpace, DigitalSet > DigitalSurfaceContainer;
+  typedef IndexedDigitalSurface< DigitalSurfaceContainer > DigSurface;
+  Point p1( -10, -10, -10 );
+  Point p2(  10,  10,  10 );
+  KSpace K;
+  K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 8 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point( 2, 1, 0 ), 3 );
+  CountedPtr< DigitalSurfaceContainer > container( new DigitalSurfaceContainer( K, aSet ) );
+  DigSurface dsurf, pdsurf;
+  bool build_ok  = dsurf.build( container );
+  bool pbuild_ok = pdsurf.build( container, true );
+  GIVEN( "A digital set boundary over a ball of radius 8 with a cavity" ) {
+    THEN( "Both builds are ok, with two connected components" ) {
+      REQUIRE( build_ok );
+      REQUIRE( pbuild_ok );
+      REQUIRE( dsurf.Euler() == 4 );
+    }
+    THEN( "Serial and parallel builds number vertices, arcs and faces the same way" ) {
+      REQUIRE( dsurf.nbVertices() == pdsurf.nbVertices() );
+      REQUIRE( dsurf.nbArcs()     == pdsurf.nbArcs() );
+      REQUIRE( dsurf.nbFaces()    == pdsurf.nbFaces() );
+      unsigned int nb_ok = 0;
+      for ( DigSurface::Vertex v = 0; v < dsurf.nbVertices(); ++v )
+        nb_ok += dsurf.surfel( v ) == pdsurf.surfel( v );
+      for ( DigSurface::Arc a = 0; a < dsurf.nbArcs(); ++a )
+        nb_ok += ( dsurf.linel( a ) == pdsurf.linel( a ) ) && ( dsurf.next( a ) == pdsurf.next( a ) );
+      for ( DigSurface::Face f = 0; f < dsurf.nbFaces(); ++f )
+        nb_ok += ( dsurf.pointel( f ) == pdsurf.pointel( f ) )
+          && ( dsurf.verticesAroundFace( f ) == pdsurf.verticesAroundFace( f ) );
+      REQUIRE( nb_ok == dsurf.nbVertices() + dsurf.nbArcs() + dsurf.nbFaces() );
+    }
+    THEN( "Surfels, linels and pointels give back their index" ) {
+      unsigned int nb_ok = 0;
+      for ( DigSurface::Vertex v = 0; v < pdsurf.nbVertices(); ++v )
+        nb_ok += pdsurf.getVertex( pdsurf.surfel( v ) ) == v;
+      for ( DigSurface::Arc a = 0; a < pdsurf.nbArcs(); ++a )
+        nb_ok += pdsurf.getArc( pdsurf.linel( a ) ) == a;
+      for ( DigSurface::Face f = 0; f < pdsurf.nbFaces(); ++f )
+        nb_ok += pdsurf.getFace( pdsurf.pointel( f ) ) == f;
+      REQUIRE( nb_ok == pdsurf.nbVertices() + pdsurf.nbArcs() + pdsurf.nbFaces() );
+      const DigSurface::Vertex invalid = DigSurface::INVALID_FACE;
+      REQUIRE( pdsurf.getVertex( K.sCell( Point( 0, 0, 0 ) ) ) == invalid );
+    }
+    THEN( "Breadth-first visiting from vertex 0 marks a component in a dense vertex set" ) {
+      BreadthFirstVisitor< DigSurface > visitor( pdsurf, 0 );
+      DigSurface::VertexMap< unsigned int >::Type distances;
+      while ( ! visitor.finished() )
+        {
+          distances[ visitor.current().first ] = visitor.current().second;
+          visitor.expand();
+        }
+      REQUIRE( visitor.visitedVertices().size() == distances.size() );
+      REQUIRE( distances.size() < pdsurf.nbVertices() );
+      REQUIRE( distances( 0 ) == 0 );
+    }
+  }
+}
+
 SCENARIO( "IndexedDigitalSurface< RealPoint3 > concept check tests", "[idxdsurf][concepts]" )
 {
   typedef DigitalSetBoundary< KSpace, DigitalSet > DigitalSurfaceContainer;
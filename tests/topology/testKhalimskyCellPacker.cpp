@@ -0,0 +1,219 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class KhalimskyCellPacker and PackedCellSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskyCellPacker.h"
+#include "DGtal/topology/KhalimskyCellContainers.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class KhalimskyCellPacker.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Checks the packed services against the ones of the space on
+ * random cells of the space [-R,R]^dim.
+ * @return the number of failures.
+ */
+template <typename KSpace>
+unsigned int checkPackedServices( int R, unsigned int nb )
+{
+  typedef KhalimskyCellPacker<KSpace> Packer;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  KSpace K;
+  K.init( Point::diagonal( -R ), Point::diagonal( R ), true );
+  unsigned int nbfail = 0;
+  SCell previous = K.sCell( Point::diagonal( 1 ), true );
+  for ( unsigned int n = 0; n < nb; ++n )
+    {
+      Point kp;
+      for ( Dimension k = 0; k < KSpace::dimension; ++k )
+        kp[ k ] = 2 * ( rand() % ( 2 * R - 1 ) - R + 1 ) + 1 + rand() % 2;
+      const SCell c = K.sCell( kp, rand() % 2 == 0 );
+      const typename Packer::PackedCell p = Packer::sPack( c );
+      nbfail += ( Packer::sUnpack( p ) == c ) ? 0 : 1;
+      nbfail += ( Packer::uUnpack( Packer::unsigns( p ) ) == K.unsigns( c ) ) ? 0 : 1;
+      nbfail += ( Packer::dim( p ) == K.sDim( c ) ) ? 0 : 1;
+      nbfail += ( Packer::sSign( p ) == ( K.sSign( c ) == K.POS ) ) ? 0 : 1;
+      nbfail += ( Packer::sUnpack( Packer::sOpp( p ) ) == K.sOpp( c ) ) ? 0 : 1;
+      nbfail += ( ( p < Packer::sPack( previous ) ) == ( c < previous ) ) ? 0 : 1;
+      for ( Dimension k = 0; k < KSpace::dimension; ++k )
+        {
+          nbfail += ( Packer::kCoord( p, k ) == K.sKCoord( c, k ) ) ? 0 : 1;
+          nbfail += ( Packer::isOpen( p, k ) == K.sIsOpen( c, k ) ) ? 0 : 1;
+          nbfail += ( Packer::sDirect( p, k ) == K.sDirect( c, k ) ) ? 0 : 1;
+          nbfail += ( Packer::sUnpack( Packer::sDirectIncident( p, k ) )
+                      == K.sDirectIncident( c, k ) ) ? 0 : 1;
+          nbfail += ( Packer::sUnpack( Packer::sIndirectIncident( p, k ) )
+                      == K.sIndirectIncident( c, k ) ) ? 0 : 1;
+          for ( int up = 0; up < 2; ++up )
+            {
+              nbfail += ( Packer::sUnpack( Packer::sIncident( p, k, up ) )
+                          == K.sIncident( c, k, up ) ) ? 0 : 1;
+              nbfail += ( Packer::uUnpack( Packer::uIncident( Packer::unsigns( p ), k, up ) )
+                          == K.uIncident( K.unsigns( c ), k, up ) ) ? 0 : 1;
+              nbfail += ( Packer::sUnpack( Packer::adjacent( p, k, up ) )
+                          == K.sAdjacent( c, k, up ) ) ? 0 : 1;
+            }
+        }
+      previous = c;
+    }
+  return nbfail;
+}
+
+TEST_CASE( "Testing KhalimskyCellPacker" )
+{
+  srand( 0 );
+  SECTION("2D services")
+    {
+      REQUIRE( checkPackedServices<Z2i::KSpace>( 1000, 2000 ) == 0 );
+    }
+  SECTION("3D services")
+    {
+      REQUIRE( checkPackedServices<Z3i::KSpace>( 1000, 2000 ) == 0 );
+    }
+  SECTION("4D services")
+    {
+      REQUIRE( checkPackedServices< KhalimskySpaceND<4, DGtal::int32_t> >( 100, 2000 ) == 0 );
+    }
+  SECTION("Packable bounds in 3D")
+    {
+      typedef KhalimskyCellPacker<Z3i::KSpace> Packer;
+      REQUIRE( Packer::bits == 21 );
+      REQUIRE( Packer::isPackable( Z3i::Point( -( 1 << 20 ), 0, ( 1 << 20 ) - 1 ) ) );
+      REQUIRE( ! Packer::isPackable( Z3i::Point( 0, 1 << 20, 0 ) ) );
+      REQUIRE( ! Packer::isPackable( Z3i::Point( 0, 0, -( 1 << 20 ) - 1 ) ) );
+    }
+}
+
+TEST_CASE( "Testing PackedCellSet" )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef PackedCellContainers<KSpace> Containers;
+  typedef KSpace::SCell SCell;
+
+  Z3i::Point p1( -12, -12, -12 ), p2( 12, 12, 12 );
+  Z3i::Domain domain( p1, p2 );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 0, 0, 0 ), 9 );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 4, 3, 0 ), 7 );
+  KSpace K;
+  K.init( p1, p2, true );
+  SurfelAdjacency<3> SAdj( true );
+
+  const SCell bel = Surfaces<KSpace>::findABel( K, set, 10000 );
+  std::set<SCell> refSurface;
+  Containers::SurfelSet surface;
+  Surfaces<KSpace>::trackBoundary( refSurface, K, SAdj, set, bel );
+  Surfaces<KSpace>::trackBoundary( surface, K, SAdj, set, bel );
+  REQUIRE( surface.size() == refSurface.size() );
+  FlatHashCellContainers<KSpace>::SurfelSet flatSurface( surface.begin(), surface.end() );
+  REQUIRE( flatSurface.size() == surface.size() );
+  REQUIRE( surface.memoryUsage() < flatSurface.memoryUsage() );
+  unsigned int nbok = 0;
+  for ( auto const& s : refSurface )
+    nbok += surface.count( s );
+  REQUIRE( nbok == refSurface.size() );
+  nbok = 0;
+  for ( auto const& s : surface )
+    nbok += refSurface.count( s );
+  REQUIRE( nbok == refSurface.size() );
+
+  typedef SetOfSurfels< KSpace, Containers::SurfelSet > Container;
+  DigitalSurface<Container> digSurf( new Container( K, SAdj, surface ) );
+  REQUIRE( digSurf.size() == refSurface.size() );
+  unsigned int nbEdges = 0;
+  for ( auto const& s : digSurf )
+    nbEdges += digSurf.degree( s );
+  REQUIRE( nbEdges == 4 * refSurface.size() );
+
+  for ( auto const& s : refSurface )
+    if ( K.sOrthDir( s ) == 0 ) surface.erase( s );
+  for ( auto it = surface.begin(); it != surface.end(); )
+    if ( K.sOrthDir( *it ) == 1 ) it = surface.erase( it );
+    else ++it;
+  nbok = 0;
+  for ( auto const& s : refSurface )
+    nbok += ( surface.count( s ) == ( K.sOrthDir( s ) == 2 ? 1 : 0 ) ) ? 1 : 0;
+  REQUIRE( nbok == refSurface.size() );
+}
+
+TEST_CASE( "Testing the packability checks of PackedCellSet" )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef KhalimskyCellPacker<KSpace> Packer;
+  typedef PackedCellSet<KSpace, KSpace::Cell> CellSet;
+  const Z3i::Integer m = 1 << 19;
+
+  SECTION( "Spaces are checked once" )
+    {
+      KSpace K;
+      K.init( Z3i::Point::diagonal( -m ), Z3i::Point::diagonal( m - 2 ), true );
+      REQUIRE( Packer::isPackable( K ) );
+      CellSet cells( K );
+      cells.insert( K.upperCell() );
+      REQUIRE( cells.count( K.upperCell() ) == 1 );
+      K.init( Z3i::Point::diagonal( -m ), Z3i::Point::diagonal( m - 1 ), true );
+      REQUIRE( ! Packer::isPackable( K ) );
+      REQUIRE_THROWS_AS( CellSet( K ), std::out_of_range );
+      REQUIRE_THROWS_AS( Packer::checkPackable( K ), std::out_of_range );
+    }
+
+  SECTION( "Cells are checked when the space is unknown" )
+    {
+      KSpace K;
+      K.init( Z3i::Point::diagonal( -2 * m ), Z3i::Point::diagonal( 2 * m ), true );
+      // Same 21 lowest bits: these cells would have the same packed cell.
+      const KSpace::Cell c = K.uCell( Z3i::Point( 0, 0, 0 ) );
+      const KSpace::Cell d = K.uCell( Z3i::Point( 4 * m, 0, 0 ) );
+      CellSet cells;
+      cells.insert( c );
+      REQUIRE_THROWS_AS( cells.insert( d ), std::out_of_range );
+      REQUIRE( cells.count( d ) == 0 );
+      REQUIRE( cells.find( d ) == cells.end() );
+      REQUIRE( cells.erase( d ) == 0 );
+      REQUIRE( cells.size() == 1 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,10 @@
  */
 
 ///////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <set>
+#include <thread>
+#include <vector>
 #include "DGtalCatch.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/Shapes.h"
@@ -318,3 +322,90 @@ SCENARIO( "Load isthmus tables", "[isthmus]" ){
     boost::ignore_unused_variable_warning(table);
   }
 }
+
+SCENARIO( "Binary and shared tables", "[binary][shared]" ){
+  SECTION("binaryTableFilename"){
+    CHECK(binaryTableFilename("dir/simplicity_table26_6.zlib") == "dir/simplicity_table26_6.bin");
+    CHECK(binaryTableFilename("table.txt") == "table.txt.bin");
+  }
+  SECTION("saveTable then loadTable reads the same table without decompression"){
+    auto ptable = loadTable<2>(simplicity::tableSimple8_4);
+    const std::string filename = "testNeighborhoodConfigurations_8_4.bin";
+    saveTable(*ptable, filename);
+    auto pbinary = loadTable(filename, 256);
+    CHECK(*pbinary == *ptable);
+    auto pbinary_uncompressed = loadTable(filename, 256, false);
+    CHECK(*pbinary_uncompressed == *ptable);
+    std::remove(filename.c_str());
+  }
+  SECTION("saveTable of a table whose size is not a multiple of 64"){
+    boost::dynamic_bitset<> table(100);
+    table[0] = table[63] = table[64] = table[99] = true;
+    const std::string filename = "testNeighborhoodConfigurations_100.bin";
+    saveTable(table, filename);
+    CHECK(*loadTable(filename, 100) == table);
+    std::remove(filename.c_str());
+  }
+  SECTION("loadSharedTable returns the same instance"){
+    const auto & table = loadSharedTable(simplicity::tableSimple26_6, 67108864);
+    const auto & shared = loadSharedTable<3>(simplicity::tableSimple26_6);
+    CHECK(&table == &shared);
+    CHECK(table == *loadTable(simplicity::tableSimple26_6));
+  }
+  SECTION("loadSharedTable returns the same instance to concurrent threads"){
+    std::vector< const boost::dynamic_bitset<> * > tables( 8, nullptr );
+    std::vector< std::thread > threads;
+    for ( std::size_t i = 0; i < tables.size(); ++i )
+      threads.emplace_back( [&tables, i] {
+          tables[ i ] = &loadSharedTable<3>(isthmusicity::tableIsthmus);
+        } );
+    for ( auto & t : threads ) t.join();
+    for ( auto p : tables ) CHECK(p == tables[ 0 ]);
+    CHECK(tables[ 0 ]->size() == 67108864);
+  }
+}
+
+TEST_CASE("Branchless configurations from bit-packed rows match the mask map", "[occupancy][rows]" )
+{
+  // A 3D image of 70 x 4 x 3 points, rows of 2 words padded with a zero
+  // word on each side and surrounded by zero rows.
+  using namespace Z3i;
+  const DGtal::int64_t width = 70, height = 4, depth = 3;
+  const std::ptrdiff_t rowStride = 4;
+  const std::ptrdiff_t sliceStride = rowStride * ( height + 2 );
+  std::vector<DGtal::uint64_t> words( sliceStride * ( depth + 2 ), 0 );
+  auto bit = [&]( DGtal::int64_t x, DGtal::int64_t y, DGtal::int64_t z ) -> DGtal::uint64_t & {
+    return words[ ( z + 1 ) * sliceStride + ( y + 1 ) * rowStride + 1 + x / 64 ];
+  };
+  auto inside = [&]( const Point & p ) {
+    return p[0] >= 0 && p[0] < width && p[1] >= 0 && p[1] < height
+      && p[2] >= 0 && p[2] < depth;
+  };
+  std::set<Point> points;
+  unsigned int seed = 17;
+  for ( DGtal::int64_t z = 0; z < depth; ++z )
+    for ( DGtal::int64_t y = 0; y < height; ++y )
+      for ( DGtal::int64_t x = 0; x < width; ++x )
+        {
+          seed = seed * 1103515245u + 12345u;
+          if ( ( seed >> 16 ) % 3 == 0 ) continue;
+          bit( x, y, z ) |= DGtal::uint64_t( 1 ) << ( x % 64 );
+          points.insert( Point( x, y, z ) );
+        }
+  auto pointToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  size_t nb_errors = 0;
+  for ( DGtal::int64_t z = 0; z < depth; ++z )
+    for ( DGtal::int64_t y = 0; y < height; ++y )
+      for ( DGtal::int64_t x = 0; x < width; ++x )
+        {
+          const Point p( x, y, z );
+          NeighborhoodConfiguration cfg = 0;
+          for ( const auto & pm : *pointToMask )
+            if ( inside( p + pm.first ) && points.count( p + pm.first ) )
+              cfg |= pm.second;
+          const DGtal::uint64_t* row = &bit( 0, y, z );
+          if ( getNeighborhoodConfigurationOccupancy<3>( row, rowStride, sliceStride, x ) != cfg )
+            ++nb_errors;
+        }
+  CHECK(nb_errors == 0);
+}
@@ -761,11 +761,7 @@ bool testSetTable()
   shape_set.erase( Point( 5, 0 ) );
   shape_set.erase( Point( -1, -2 ) );
   Object4_8 shape( dt4_8, shape_set );
-  // shape.setTable(functions::loadTable<2>(simplicity::tableSimple4_8));
-  {
-    auto table_smart_ptr = functions::loadTable<2>(simplicity::tableSimple4_8);
-    shape.setTable(table_smart_ptr); // table must survive (smart_ptr)
-  }
+  shape.setTable(simplicity::tableSimple4_8); // shared by the process
 
   GradientColorMap<int> cmap_grad( 0, 6 );
   cmap_grad.addColor( Color( 128, 128, 255 ) );
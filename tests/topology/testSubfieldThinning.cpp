@@ -0,0 +1,222 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class SubfieldThinning.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/VoxelComplexFunctions.h"
+#include "DGtal/topology/SubfieldThinning.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SubfieldThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef SubfieldThinning< Domain > Thinning;
+typedef Thinning::Image            BitImage;
+typedef Thinning::Index            Index;
+
+/// Fills @a image with a solid torus of radii @a R and @a r around the z-axis.
+void makeTorus( BitImage & image, double R, double r )
+{
+  for ( auto const& p : image.domain() )
+    {
+      const double d = std::sqrt( double( p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] ) ) - R;
+      if ( d * d + double( p[ 2 ] * p[ 2 ] ) <= r * r )
+        image.setValue( p, true );
+    }
+}
+
+/// @return the set of points of @a image.
+DigitalSet toSet( const BitImage & image )
+{
+  DigitalSet set( image.domain() );
+  for ( auto const& p : image.domain() )
+    if ( image( p ) ) set.insertNew( p );
+  return set;
+}
+
+/// @return the Euler characteristic of the closed complex of the voxels of @a set.
+template <typename TSet>
+Integer euler( const TSet & set, const Domain & domain )
+{
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  CubicalComplex< KSpace, std::map< KSpace::Cell, CubicalCellData > > complex( K );
+  for ( auto const& p : set ) complex.insertCell( K.uSpel( p ) );
+  complex.close();
+  return complex.euler();
+}
+
+/// @return the number of 26-connected components of @a set.
+Index nbComponents( const DigitalSet & set )
+{
+  typedef Object< DT26_6, DigitalSet > Object26;
+  Object26 object( dt26_6, set );
+  std::vector< Object26 > components;
+  auto it = std::back_inserter( components );
+  return object.writeComponents( it );
+}
+
+/// @return the number of voxels of @a image that are simple.
+Index nbSimpleVoxels( const BitImage & image, const Thinning::ConfigMap & table )
+{
+  Index nb = 0;
+  for ( auto const& p : image.domain() )
+    if ( image( p ) && table[ image.getNeighborhoodConfiguration( p ) ] ) ++nb;
+  return nb;
+}
+
+TEST_CASE( "Testing SubfieldThinning" )
+{
+  const Domain domain( Point( -12, -12, -5 ), Point( 12, 12, 5 ) );
+  const auto & simple = functions::loadSharedTable( simplicity::tableSimple26_6 );
+  BitImage input( domain );
+  makeTorus( input, 8.5, 3.0 );
+  // A second component, with a cavity.
+  for ( auto const& p : Domain( Point( -2, -2, -2 ), Point( 2, 2, 2 ) ) )
+    if ( p != Point( 0, 0, 0 ) ) input.setValue( p, true );
+  const DigitalSet inputSet = toSet( input );
+  const Integer inputEuler = euler( inputSet, domain );
+  REQUIRE( inputEuler == 2 ); // 0 (torus) + 2 (sphere)
+  REQUIRE( nbComponents( inputSet ) == 2 );
+
+  SECTION( "Border voxels" )
+    {
+      BitImage image( input );
+      Thinning thinning( image, simple );
+      REQUIRE( thinning.isValid() );
+      std::vector< Index > border;
+      for ( auto const& p : domain )
+        {
+          if ( ! image( p ) ) continue;
+          bool interior = true;
+          for ( Dimension k = 0; k < 3; ++k )
+            for ( int d = -1; d <= 1; d += 2 )
+              {
+                const Point q = p + Point::base( k, d );
+                interior = interior && domain.isInside( q ) && image( q );
+              }
+          if ( ! interior ) border.push_back( thinning.index( p ) );
+        }
+      std::sort( border.begin(), border.end() );
+      REQUIRE( thinning.borderVoxels( false ) == border );
+      REQUIRE( thinning.borderVoxels( true ) == border );
+      REQUIRE( thinning.point( border[ 5 ] ) == thinning.point( thinning.index( thinning.point( border[ 5 ] ) ) ) );
+    }
+
+  SECTION( "Ultimate thinning preserves the topology, in serial and in parallel" )
+    {
+      BitImage image( input );
+      Thinning thinning( image, simple );
+      const Index nbRemoved = thinning.thin( false );
+      BitImage imagePar( input );
+      Thinning thinningPar( imagePar, simple );
+      REQUIRE( thinningPar.thin( true ) == nbRemoved );
+      REQUIRE( std::equal( image.constRange().begin(), image.constRange().end(),
+                           imagePar.constRange().begin() ) );
+      REQUIRE( image.count() + nbRemoved == input.count() );
+      REQUIRE( nbSimpleVoxels( image, simple ) == 0 );
+      const DigitalSet result = toSet( image );
+      REQUIRE( euler( result, domain ) == inputEuler );
+      REQUIRE( nbComponents( result ) == 2 );
+      for ( auto const& p : result ) REQUIRE( input( p ) );
+    }
+
+  SECTION( "Priority, fixed voxels and skeleton table" )
+    {
+      BitImage image( input );
+      Thinning thinning( image, simple );
+      thinning.setSkeletonTable( isthmusicity::tableIsthmus );
+      const Point anchor( 0, 9, 0 );
+      thinning.fix( anchor );
+      // Removes first the voxels far from the z = 0 plane.
+      auto priority = []( const Point & p ) { return -std::abs( p[ 2 ] ); };
+      thinning.thin( priority, true );
+      REQUIRE( image( anchor ) );
+      REQUIRE( thinning.isFixed( anchor ) );
+      const DigitalSet result = toSet( image );
+      REQUIRE( euler( result, domain ) == inputEuler );
+      REQUIRE( nbComponents( result ) == 2 );
+      // Only fixed voxels may be simple.
+      for ( auto const& p : result )
+        if ( simple[ image.getNeighborhoodConfiguration( p ) ] )
+          REQUIRE( thinning.isFixed( p ) );
+      // The isthmuses found during the thinning are fixed and kept.
+      REQUIRE( thinning.fixedVoxels().count() > 1 );
+      for ( auto const& p : domain )
+        if ( thinning.isFixed( p ) ) REQUIRE( image( p ) );
+    }
+}
+
+TEST_CASE( "Comparing SubfieldThinning with asymetricThinningScheme" )
+{
+  typedef std::unordered_map< KSpace::Cell, CubicalCellData > Map;
+  typedef VoxelComplex< KSpace, Map > Complex;
+  const Domain domain( Point( -7, -7, -3 ), Point( 7, 7, 3 ) );
+  const auto & simple = functions::loadSharedTable( simplicity::tableSimple26_6 );
+  BitImage image( domain );
+  makeTorus( image, 4.0, 1.5 );
+  const DigitalSet inputSet = toSet( image );
+
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  Complex vc( K );
+  vc.construct( inputSet, simple );
+  auto thinned = functions::asymetricThinningScheme< Complex >
+    ( vc, functions::selectFirst< Complex >, functions::skelUltimate< Complex > );
+  DigitalSet thinnedSet( domain );
+  for ( auto it = thinned.begin( 3 ), itE = thinned.end( 3 ); it != itE; ++it )
+    thinnedSet.insertNew( K.uCoords( it->first ) );
+
+  Thinning( image, simplicity::tableSimple26_6 ).thin( true );
+  const DigitalSet result = toSet( image );
+  REQUIRE( euler( result, domain ) == euler( inputSet, domain ) );
+  REQUIRE( euler( result, domain ) == euler( thinnedSet, domain ) );
+  REQUIRE( nbComponents( result ) == nbComponents( thinnedSet ) );
+  REQUIRE( nbSimpleVoxels( image, simple ) == 0 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -314,6 +314,120 @@ bool testFindABel()
   return nbok == nb;
 }
 
+/**
+* Checks that Surfaces::sWriteBoundaryParallel writes exactly the
+* same sequence of surfels as Surfaces::sWriteBoundary, whatever the
+* number of slabs, and that the parallel sMakeBoundary and
+* uMakeBoundary give the same sets.
+*/
+template <typename KSpace>
+bool testWriteBoundaryParallel()
+{
+  typedef typename KSpace::Space     Space;
+  typedef typename KSpace::Point     Point;
+  typedef typename KSpace::Cell      Cell;
+  typedef typename KSpace::SCell     SCell;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::sWriteBoundaryParallel." );
+  Point p1 = Point::diagonal( -9 );
+  Point p2 = Point::diagonal( 10 );
+  KSpace K; K.init( p1, p2, true );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::zero, 6 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::diagonal( 4 ), 5 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point::diagonal( -2 ), 3 );
+  std::vector<SCell> ref;
+  std::back_insert_iterator< std::vector<SCell> > ref_it = std::back_inserter( ref );
+  Surfaces<KSpace>::sWriteBoundary( ref_it, K, aSet, K.lowerBound(), K.upperBound() );
+  for ( unsigned int nbSlabs = 0; nbSlabs <= 40; nbSlabs += 7 )
+    {
+      std::vector<SCell> surfels;
+      std::back_insert_iterator< std::vector<SCell> > it = std::back_inserter( surfels );
+      Surfaces<KSpace>::sWriteBoundaryParallel( it, K, aSet,
+                                                K.lowerBound(), K.upperBound(), nbSlabs );
+      ++nb; nbok += ( surfels == ref ) ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << surfels.size() << " surfels with " << nbSlabs << " slabs"
+                   << " (should be " << ref.size() << ")" << std::endl;
+    }
+  std::set<SCell> refSSet, sset;
+  std::set<Cell> refUSet, uset;
+  Surfaces<KSpace>::sMakeBoundary( refSSet, K, aSet, K.lowerBound(), K.upperBound() );
+  Surfaces<KSpace>::sMakeBoundaryParallel( sset, K, aSet, K.lowerBound(), K.upperBound() );
+  Surfaces<KSpace>::uMakeBoundary( refUSet, K, aSet, K.lowerBound(), K.upperBound() );
+  Surfaces<KSpace>::uMakeBoundaryParallel( uset, K, aSet, K.lowerBound(), K.upperBound() );
+  ++nb; nbok += ( sset == refSSet && sset.size() == ref.size() ) ? 1 : 0;
+  ++nb; nbok += ( uset == refUSet && uset.size() == ref.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sets of surfels are the same." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+* Checks that Surfaces::labelAllConnectedSCell (and thus
+* extractAllConnectedSCell) gives the components obtained by tracking
+* the boundary from the smallest unmarked bel.
+*/
+template <typename KSpace>
+bool testLabelAllConnectedSCell( bool interior )
+{
+  typedef typename KSpace::Space     Space;
+  typedef typename KSpace::Point     Point;
+  typedef typename KSpace::SCell     SCell;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::labelAllConnectedSCell." );
+  Point p1 = Point::diagonal( -12 );
+  Point p2 = Point::diagonal( 12 );
+  KSpace K; K.init( p1, p2, true );
+  SurfelAdjacency<KSpace::dimension> SAdj( interior );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::diagonal( -6 ), 4 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::diagonal( 5 ), 6 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point::diagonal( 5 ), 3 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::diagonal( 5 ), 1 );
+  for ( unsigned int i = 0; i < 5; ++i ) // isolated or touching spels
+    aSet.insert( Point::diagonal( -11 + 2 * i - ( i % 2 ) ) );
+  // Reference components.
+  std::set<SCell> bdry;
+  std::vector< std::vector<SCell> > ref;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, aSet, K.lowerBound(), K.upperBound() );
+  while ( ! bdry.empty() )
+    {
+      std::set<SCell> component;
+      Surfaces<KSpace>::trackBoundary( component, K, SAdj, aSet, *( bdry.begin() ) );
+      for ( auto const& s : component ) bdry.erase( s );
+      ref.push_back( std::vector<SCell>( component.begin(), component.end() ) );
+    }
+  std::vector<SCell> bels;
+  std::vector<std::size_t> labels, sizes;
+  std::size_t nbComp = Surfaces<KSpace>::labelAllConnectedSCell
+    ( bels, labels, sizes, K, SAdj, aSet );
+  ++nb; nbok += ( nbComp == ref.size() && sizes.size() == ref.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbComp << " components (should be " << ref.size() << ")" << std::endl;
+  std::vector< std::vector<SCell> > components;
+  Surfaces<KSpace>::extractAllConnectedSCell( components, K, SAdj, aSet );
+  ++nb; nbok += ( components == ref ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "extractAllConnectedSCell gives the tracked components." << std::endl;
+  bool ok = sizes.size() == ref.size();
+  for ( std::size_t c = 0; ok && c < ref.size(); ++c )
+    ok = sizes[ c ] == ref[ c ].size();
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "components have the tracked sizes." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -327,7 +441,12 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testWriteBoundaryParallel< KhalimskySpaceND<2,int> >()
+    && testWriteBoundaryParallel< KhalimskySpaceND<3,int> >()
+    && testLabelAllConnectedSCell< KhalimskySpaceND<2,int> >( true )
+    && testLabelAllConnectedSCell< KhalimskySpaceND<3,int> >( true )
+    && testLabelAllConnectedSCell< KhalimskySpaceND<3,int> >( false );
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
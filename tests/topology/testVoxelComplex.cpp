@@ -314,7 +314,7 @@ TEST_CASE_METHOD(Fixture_complex_diamond, "Test table wrappers",
                  "[table][simple]") {
     auto &vc = complex_fixture;
     trace.beginBlock("loadTable");
-    vc.setSimplicityTable(functions::loadTable(simplicity::tableSimple26_6));
+    vc.setSimplicityTable(simplicity::tableSimple26_6);
     trace.endBlock();
     auto dim_voxel = 3;
     auto cit = vc.begin(dim_voxel);
@@ -829,7 +829,7 @@ TEST_CASE_METHOD(Fixture_isthmus, "Persistence thin",
         //    vc, selectRandom<FixtureComplex>, oneIsthmus<FixtureComplex>, 0);
         //
         // with LUT:
-        auto table = *functions::loadTable(isthmusicity::tableOneIsthmus);
+        const auto & table = functions::loadSharedTable(isthmusicity::tableOneIsthmus);
         auto pointToMaskMap =
             *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
         auto oneIsthmusTable =
@@ -847,7 +847,7 @@ TEST_CASE_METHOD(Fixture_isthmus, "Persistence thin",
         //    vc, selectRandom<FixtureComplex>, twoIsthmus<FixtureComplex>, 0);
         //
         // with LUT:
-        auto table = *functions::loadTable(isthmusicity::tableTwoIsthmus);
+        const auto & table = functions::loadSharedTable(isthmusicity::tableTwoIsthmus);
         auto pointToMaskMap =
             *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
         auto twoIsthmusTable =
@@ -865,7 +865,7 @@ TEST_CASE_METHOD(Fixture_isthmus, "Persistence thin",
         //   vc, selectRandom<FixtureComplex>, skelIsthmus<FixtureComplex>, 0);
         //
         // with LUT:
-        auto table = *functions::loadTable(isthmusicity::tableIsthmus);
+        const auto & table = functions::loadSharedTable(isthmusicity::tableIsthmus);
         auto pointToMaskMap =
             *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
         auto isthmusTable = [&table,
@@ -1019,7 +1019,7 @@ TEST_CASE_METHOD(Fixture_X, "X Thin with Isthmus, and tables",
     // }
     SECTION("Compute with skelWithTable (isIsthmus)") {
         trace.beginBlock("Fixture_X skelIsthmus with table");
-        auto table = *functions::loadTable(isthmusicity::tableIsthmus);
+        const auto & table = functions::loadSharedTable(isthmusicity::tableIsthmus);
         auto pointToMaskMap =
             *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
         auto skelWithTableIsthmus =
@@ -1037,9 +1037,9 @@ TEST_CASE_METHOD(Fixture_X, "X Thin with Isthmus, and tables",
     SECTION("Compute with skelWithTable (isIsthmus) and empty Object") {
         trace.beginBlock("Fixture_X skelIsthmus with table (empty objectSet)");
         vc.setSimplicityTable(
-            functions::loadTable(simplicity::tableSimple26_6));
+            functions::loadSharedTable(simplicity::tableSimple26_6));
         vc.clear();
-        auto table = *functions::loadTable(isthmusicity::tableIsthmus);
+        const auto & table = functions::loadSharedTable(isthmusicity::tableIsthmus);
         auto pointToMaskMap =
             *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
         auto skelWithTableIsthmus =
@@ -1078,7 +1078,7 @@ TEST_CASE_METHOD(Fixture_X, "X DistanceMap", "[x][distance][thin]") {
                     vc, selectDistMax, skelEnd<FixtureComplex>, verbose);
         }
         SECTION("persistenceThinning"){
-            auto table = *functions::loadTable(isthmusicity::tableOneIsthmus);
+            const auto & table = functions::loadSharedTable(isthmusicity::tableOneIsthmus);
             auto pointToMaskMap =
                 *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>();
             auto oneIsthmusTable =